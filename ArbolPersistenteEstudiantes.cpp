@@ -0,0 +1,197 @@
+#include "ArbolPersistenteEstudiantes.h"
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using PunteroNodo = std::shared_ptr<const NodoPersistente>;
+using PunteroEstudiante = std::shared_ptr<const Estudiante>;
+
+int alturaDe(const PunteroNodo& nodo) {
+    return nodo ? nodo->altura : 0;
+}
+
+int tamanioDe(const PunteroNodo& nodo) {
+    return nodo ? nodo->tamanio : 0;
+}
+
+// Crea un nodo nuevo con altura y tamaño calculados a partir de sus hijos
+PunteroNodo crearNodo(const PunteroEstudiante& estudiante, uint64_t clave, PunteroNodo izquierdo,
+                      PunteroNodo derecho) {
+    std::shared_ptr<NodoPersistente> nodo = std::make_shared<NodoPersistente>();
+    nodo->estudiante = estudiante;
+    nodo->clave = clave;
+    nodo->altura = 1 + std::max(alturaDe(izquierdo), alturaDe(derecho));
+    nodo->tamanio = 1 + tamanioDe(izquierdo) + tamanioDe(derecho);
+    nodo->izquierdo = std::move(izquierdo);
+    nodo->derecho = std::move(derecho);
+    return nodo;
+}
+
+// Copia de `nodo` (mismo estudiante y clave) con otros hijos
+PunteroNodo copiarCon(const NodoPersistente& nodo, PunteroNodo izquierdo, PunteroNodo derecho) {
+    return crearNodo(nodo.estudiante, nodo.clave, std::move(izquierdo), std::move(derecho));
+}
+
+/**
+ * @brief Copia `nodo` con los hijos dados, aplicando la rotación AVL que haga falta.
+ *
+ * Las rotaciones también crean nodos nuevos en lugar de reenlazar los existentes, que
+ * pueden pertenecer a versiones que se están leyendo.
+ */
+PunteroNodo balancear(const NodoPersistente& nodo, PunteroNodo izquierdo, PunteroNodo derecho) {
+    const int balance = alturaDe(izquierdo) - alturaDe(derecho);
+    if (balance > 1) {
+        if (alturaDe(izquierdo->izquierdo) >= alturaDe(izquierdo->derecho)) {
+            return copiarCon(*izquierdo, izquierdo->izquierdo, copiarCon(nodo, izquierdo->derecho, std::move(derecho)));
+        }
+        const NodoPersistente& medio = *izquierdo->derecho;
+        return copiarCon(medio, copiarCon(*izquierdo, izquierdo->izquierdo, medio.izquierdo),
+                         copiarCon(nodo, medio.derecho, std::move(derecho)));
+    }
+    if (balance < -1) {
+        if (alturaDe(derecho->derecho) >= alturaDe(derecho->izquierdo)) {
+            return copiarCon(*derecho, copiarCon(nodo, std::move(izquierdo), derecho->izquierdo), derecho->derecho);
+        }
+        const NodoPersistente& medio = *derecho->izquierdo;
+        return copiarCon(medio, copiarCon(nodo, std::move(izquierdo), medio.izquierdo),
+                         copiarCon(*derecho, medio.derecho, derecho->derecho));
+    }
+    return copiarCon(nodo, std::move(izquierdo), std::move(derecho));
+}
+
+// Devuelve la raíz de una versión con el estudiante agregado; si la clave ya estaba, la misma raíz
+PunteroNodo insertarPersistente(const PunteroNodo& nodo, const PunteroEstudiante& estudiante, uint64_t clave,
+                                bool& insertado) {
+    if (!nodo) {
+        insertado = true;
+        return crearNodo(estudiante, clave, nullptr, nullptr);
+    }
+    if (clave < nodo->clave) {
+        PunteroNodo izquierdo = insertarPersistente(nodo->izquierdo, estudiante, clave, insertado);
+        return insertado ? balancear(*nodo, std::move(izquierdo), nodo->derecho) : nodo;
+    }
+    if (clave > nodo->clave) {
+        PunteroNodo derecho = insertarPersistente(nodo->derecho, estudiante, clave, insertado);
+        return insertado ? balancear(*nodo, nodo->izquierdo, std::move(derecho)) : nodo;
+    }
+    return nodo;
+}
+
+// Quita el mínimo de un subárbol no vacío y lo entrega en `minimo`
+PunteroNodo quitarMinimo(const PunteroNodo& nodo, PunteroNodo& minimo) {
+    if (!nodo->izquierdo) {
+        minimo = nodo;
+        return nodo->derecho;
+    }
+    PunteroNodo izquierdo = quitarMinimo(nodo->izquierdo, minimo);
+    return balancear(*nodo, std::move(izquierdo), nodo->derecho);
+}
+
+// Devuelve la raíz de una versión sin la clave; `eliminado` recibe el nodo quitado, si estaba
+PunteroNodo eliminarPersistente(const PunteroNodo& nodo, uint64_t clave, PunteroNodo& eliminado) {
+    if (!nodo) return nullptr;
+    if (clave < nodo->clave) {
+        PunteroNodo izquierdo = eliminarPersistente(nodo->izquierdo, clave, eliminado);
+        return eliminado ? balancear(*nodo, std::move(izquierdo), nodo->derecho) : nodo;
+    }
+    if (clave > nodo->clave) {
+        PunteroNodo derecho = eliminarPersistente(nodo->derecho, clave, eliminado);
+        return eliminado ? balancear(*nodo, nodo->izquierdo, std::move(derecho)) : nodo;
+    }
+    eliminado = nodo;
+    if (!nodo->izquierdo) return nodo->derecho;
+    if (!nodo->derecho) return nodo->izquierdo;
+    // El sucesor ocupa el lugar del nodo quitado, con el subárbol derecho ya sin él
+    PunteroNodo sucesor;
+    PunteroNodo derecho = quitarMinimo(nodo->derecho, sucesor);
+    return balancear(*sucesor, nodo->izquierdo, std::move(derecho));
+}
+
+// Construye un árbol balanceado con copias de estudiantes ordenados por clave, en O(n)
+PunteroNodo construirBalanceado(const std::vector<const Estudiante*>& estudiantes, size_t inicio, size_t fin) {
+    if (inicio >= fin) return nullptr;
+    size_t medio = inicio + (fin - inicio) / 2;
+    PunteroNodo izquierdo = construirBalanceado(estudiantes, inicio, medio);
+    PunteroNodo derecho = construirBalanceado(estudiantes, medio + 1, fin);
+    const Estudiante* est = estudiantes[medio];
+    return crearNodo(std::make_shared<const Estudiante>(*est), NodoAVL_Estudiantes::generarClave(est),
+                     std::move(izquierdo), std::move(derecho));
+}
+
+} // namespace
+
+VersionEstudiantes::VersionEstudiantes() : conteoEstilos{} {}
+
+size_t VersionEstudiantes::getCantidad() const {
+    return (size_t)tamanioDe(raiz);
+}
+
+EstiloBaile VersionEstudiantes::getEstiloMasPopular() const {
+    return estiloMasPopular(conteoEstilos);
+}
+
+ArbolPersistenteEstudiantes::ArbolPersistenteEstudiantes()
+    : actual(std::make_shared<const VersionEstudiantes>()) {}
+
+std::shared_ptr<const VersionEstudiantes> ArbolPersistenteEstudiantes::instantanea() const {
+    return std::atomic_load_explicit(&actual, std::memory_order_acquire);
+}
+
+/**
+ * @brief Arma la versión siguiente con la raíz y los conteos ajustados, y la publica.
+ *
+ * La versión queda completa antes del intercambio, por lo que un lector nunca ve una
+ * raíz nueva con conteos viejos. La versión reemplazada se libera cuando la suelte su último lector.
+ */
+void ArbolPersistenteEstudiantes::publicar(std::shared_ptr<const NodoPersistente> raiz,
+                                           const VersionEstudiantes& anterior, uint8_t mascaraSumada,
+                                           uint8_t mascaraRestada) {
+    std::shared_ptr<VersionEstudiantes> version = std::make_shared<VersionEstudiantes>();
+    version->raiz = std::move(raiz);
+    for (int j = 0; j < NUM_ESTILOS_BAILE; ++j) {
+        version->conteoEstilos[j] = anterior.conteoEstilos[j] + ((mascaraSumada >> j) & 1u) -
+                                    ((mascaraRestada >> j) & 1u);
+    }
+    std::atomic_store_explicit(&actual, std::shared_ptr<const VersionEstudiantes>(std::move(version)),
+                              std::memory_order_release);
+}
+
+bool ArbolPersistenteEstudiantes::insertar(const Estudiante& est) {
+    std::shared_ptr<const VersionEstudiantes> anterior = instantanea();
+    bool insertado = false;
+    PunteroNodo raiz = insertarPersistente(anterior->raiz, std::make_shared<const Estudiante>(est),
+                                           NodoAVL_Estudiantes::generarClave(&est), insertado);
+    if (!insertado) return false;
+    publicar(std::move(raiz), *anterior, est.getMascaraPreferencias(), 0);
+    return true;
+}
+
+bool ArbolPersistenteEstudiantes::eliminar(uint64_t clave) {
+    std::shared_ptr<const VersionEstudiantes> anterior = instantanea();
+    PunteroNodo eliminado;
+    PunteroNodo raiz = eliminarPersistente(anterior->raiz, clave, eliminado);
+    if (!eliminado) return false;
+    publicar(std::move(raiz), *anterior, 0, eliminado->estudiante->getMascaraPreferencias());
+    return true;
+}
+
+/**
+ * @brief Copia los estudiantes a un árbol nuevo construido en bloque y lo publica como una sola versión.
+ */
+void ArbolPersistenteEstudiantes::reconstruir(const RangoEstudiantes& estudiantes) {
+    std::vector<const Estudiante*> ordenados;
+    for (const Estudiante& est : estudiantes) ordenados.push_back(&est);
+
+    std::shared_ptr<VersionEstudiantes> version = std::make_shared<VersionEstudiantes>();
+    version->raiz = construirBalanceado(ordenados, 0, ordenados.size());
+    for (const Estudiante* est : ordenados) {
+        const unsigned mascara = est->getMascaraPreferencias();
+        for (int j = 0; j < NUM_ESTILOS_BAILE; ++j) {
+            version->conteoEstilos[j] += (mascara >> j) & 1u;
+        }
+    }
+    std::atomic_store_explicit(&actual, std::shared_ptr<const VersionEstudiantes>(std::move(version)),
+                              std::memory_order_release);
+}
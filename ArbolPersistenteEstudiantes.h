@@ -0,0 +1,175 @@
+#ifndef ARBOL_PERSISTENTE_ESTUDIANTES_H
+#define ARBOL_PERSISTENTE_ESTUDIANTES_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include "EstiloBaile.h"
+#include "Estudiante.h"
+#include "RangoEstudiantes.h"
+
+/**
+ * @brief Nodo inmutable del árbol persistente de estudiantes.
+ *
+ * Una vez publicado no se modifica nunca: una inserción o eliminación crea copias de los
+ * nodos del camino desde la raíz y comparte el resto con la versión anterior. Los nodos,
+ * y la copia del estudiante que guardan, se liberan al soltarse la última versión que los usa.
+ */
+struct NodoPersistente {
+    std::shared_ptr<const Estudiante> estudiante;
+    std::shared_ptr<const NodoPersistente> izquierdo;
+    std::shared_ptr<const NodoPersistente> derecho;
+    uint64_t clave;     ///< Misma clave que NodoAVL_Estudiantes (fecha de matrícula + ID)
+    int altura;
+    int tamanio;        ///< Cantidad de nodos del subárbol
+};
+
+/**
+ * @class VersionEstudiantes
+ * @brief Estado de los estudiantes en un instante: raíz del árbol y conteo de preferencias.
+ *
+ * Es inmutable, por lo que puede recorrerse desde cualquier hilo sin bloqueos mientras
+ * se conserve el puntero obtenido con ArbolPersistenteEstudiantes::instantanea().
+ * Los conteos corresponden exactamente a los estudiantes del árbol de la misma versión.
+ */
+class VersionEstudiantes {
+private:
+    std::shared_ptr<const NodoPersistente> raiz;
+    size_t conteoEstilos[NUM_ESTILOS_BAILE];
+
+    friend class ArbolPersistenteEstudiantes;
+
+public:
+    VersionEstudiantes();
+
+    /**
+     * @brief Cantidad de estudiantes de la versión, en O(1).
+     */
+    size_t getCantidad() const;
+
+    /**
+     * @brief Estilo más popular entre los estudiantes de la versión (ver estiloMasPopular()).
+     *
+     * Lo usa SistemaConcurrente::calcularPagos() para no leer los contadores del Sistema.
+     */
+    EstiloBaile getEstiloMasPopular() const;
+
+    /**
+     * @brief Recorre en orden de matrícula los estudiantes con clave en [claveInicio, claveFin].
+     *
+     * Usa una pila de tamaño fijo, sin recursión ni reservas; ubicar el primero cuesta O(log n).
+     *
+     * @param funcion Se llama con `const Estudiante&` por cada estudiante; si devuelve bool,
+     *                false detiene el recorrido (así se entrega un listado por bloques).
+     * @param claveInicio Clave mínima (ver RangoEstudiantes::claveDesde()).
+     * @param claveFin Clave máxima (ver RangoEstudiantes::claveHasta()).
+     * @param mascaraFiltro Si no es 0, solo se visitan los que prefieren alguno de esos estilos.
+     */
+    template <typename Funcion>
+    void recorrer(Funcion&& funcion, uint64_t claveInicio = 0, uint64_t claveFin = UINT64_MAX,
+                  uint8_t mascaraFiltro = 0) const;
+};
+
+/**
+ * @class ArbolPersistenteEstudiantes
+ * @brief Variante inmutable del AVL de estudiantes, con copia de camino, para lecturas sin bloqueos.
+ *
+ * Cada inserción o eliminación construye una nueva VersionEstudiantes copiando los O(log n)
+ * nodos del camino modificado (incluidas las rotaciones) y la publica con un único
+ * intercambio atómico de puntero. Un lector toma la versión actual en O(1) (lo único que
+ * comparte con el escritor es la copia de ese puntero) y la recorre sin bloqueos; los
+ * cambios posteriores no la alteran. Las versiones viejas se liberan por
+ * conteo de referencias cuando el último lector las suelta.
+ *
+ * Los estudiantes se copian al insertarlos, de modo que una versión no depende de la
+ * memoria del AVL principal. Las modificaciones deben venir de un solo hilo a la vez
+ * (el mismo que modifica el Sistema); las lecturas pueden venir de cualquier hilo.
+ */
+class ArbolPersistenteEstudiantes {
+private:
+    /// Versión publicada; solo se lee y se reemplaza con std::atomic_load/atomic_store. No se usa
+    /// std::atomic<std::shared_ptr>: la de libstdc++ 12 suelta su cerrojo interno al leer con
+    /// orden relajado, lo que no ordena esa lectura con el reemplazo siguiente.
+    std::shared_ptr<const VersionEstudiantes> actual;
+
+    /**
+     * @brief Publica una versión nueva a partir de la actual con otra raíz.
+     *
+     * @param raiz Raíz de la versión nueva.
+     * @param anterior Versión de la que se parte.
+     * @param mascaraSumada Preferencias del estudiante agregado (0 si ninguno).
+     * @param mascaraRestada Preferencias del estudiante quitado (0 si ninguno).
+     */
+    void publicar(std::shared_ptr<const NodoPersistente> raiz, const VersionEstudiantes& anterior,
+                  uint8_t mascaraSumada, uint8_t mascaraRestada);
+
+public:
+    /**
+     * @brief Construye un árbol vacío, con una versión vacía publicada.
+     */
+    ArbolPersistenteEstudiantes();
+
+    ArbolPersistenteEstudiantes(const ArbolPersistenteEstudiantes&) = delete;
+    ArbolPersistenteEstudiantes& operator=(const ArbolPersistenteEstudiantes&) = delete;
+
+    /**
+     * @brief Obtiene la versión publicada más reciente, en O(1) y sin bloquear a los escritores.
+     */
+    std::shared_ptr<const VersionEstudiantes> instantanea() const;
+
+    /**
+     * @brief Publica una versión con una copia del estudiante agregada.
+     *
+     * @return false si ya había un estudiante con la misma clave (no se publica nada).
+     */
+    bool insertar(const Estudiante& est);
+
+    /**
+     * @brief Publica una versión sin el estudiante de la clave dada.
+     *
+     * @return false si la clave no estaba (no se publica nada).
+     */
+    bool eliminar(uint64_t clave);
+
+    /**
+     * @brief Reemplaza el contenido por una copia de los estudiantes dados, en O(n).
+     *
+     * @param estudiantes Estudiantes en orden de clave, por ejemplo Sistema::estudiantes().
+     */
+    void reconstruir(const RangoEstudiantes& estudiantes);
+};
+
+template <typename Funcion>
+void VersionEstudiantes::recorrer(Funcion&& funcion, uint64_t claveInicio, uint64_t claveFin,
+                                  uint8_t mascaraFiltro) const {
+    const NodoPersistente* pila[IteradorRangoEstudiantes::ALTURA_MAXIMA];
+    int tope = 0;
+    const NodoPersistente* nodo = raiz.get();
+    for (;;) {
+        // Los nodos con clave menor que el inicio se saltan junto con su subárbol izquierdo
+        while (nodo) {
+            if (nodo->clave < claveInicio) {
+                nodo = nodo->derecho.get();
+            } else {
+                pila[tope++] = nodo;
+                nodo = nodo->izquierdo.get();
+            }
+        }
+        if (tope == 0) return;
+        nodo = pila[--tope];
+        if (nodo->clave > claveFin) return;
+        if (mascaraFiltro == 0 || (nodo->estudiante->getMascaraPreferencias() & mascaraFiltro)) {
+            const Estudiante& est = *nodo->estudiante;
+            if constexpr (std::is_same_v<std::invoke_result_t<Funcion&, const Estudiante&>, bool>) {
+                if (!funcion(est)) return;
+            } else {
+                funcion(est);
+            }
+        }
+        nodo = nodo->derecho.get();
+    }
+}
+
+#endif // ARBOL_PERSISTENTE_ESTUDIANTES_H
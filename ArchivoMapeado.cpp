@@ -0,0 +1,131 @@
+#include "ArchivoMapeado.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Constructor por defecto: no hay archivo asociado.
+ */
+ArchivoMapeado::ArchivoMapeado()
+    : datos(nullptr),
+      tamanio(0),
+      abierto(false),
+#ifdef _WIN32
+      archivo(INVALID_HANDLE_VALUE),
+      mapeo(nullptr)
+#else
+      descriptor(-1)
+#endif
+{
+}
+
+/**
+ * @brief Destructor: libera la proyección y cierra el archivo.
+ */
+ArchivoMapeado::~ArchivoMapeado() {
+    cerrar();
+}
+
+/**
+ * @brief Abre y proyecta un archivo completo en memoria.
+ *
+ * Si ya había un archivo abierto, se cierra primero. En POSIX se indica además
+ * al núcleo que el acceso será secuencial, para que adelante la lectura de páginas.
+ *
+ * @param ruta Ruta del archivo a proyectar.
+ * @return true si el archivo quedó proyectado (o es vacío); false si no pudo abrirse.
+ */
+bool ArchivoMapeado::abrir(const std::string& ruta) {
+    cerrar();
+#ifdef _WIN32
+    HANDLE hArchivo = CreateFileA(ruta.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (hArchivo == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER tam;
+    if (!GetFileSizeEx(hArchivo, &tam)) {
+        CloseHandle(hArchivo);
+        return false;
+    }
+    archivo = hArchivo;
+    tamanio = (size_t)tam.QuadPart;
+    abierto = true;
+    if (tamanio == 0) return true;
+
+    HANDLE hMapeo = CreateFileMappingA(hArchivo, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!hMapeo) {
+        cerrar();
+        return false;
+    }
+    mapeo = hMapeo;
+    datos = static_cast<const char*>(MapViewOfFile(hMapeo, FILE_MAP_READ, 0, 0, 0));
+    if (!datos) {
+        cerrar();
+        return false;
+    }
+#else
+    int fd = ::open(ruta.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+    descriptor = fd;
+    tamanio = (size_t)info.st_size;
+    abierto = true;
+    if (tamanio == 0) return true;
+
+    void* p = mmap(nullptr, tamanio, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p == MAP_FAILED) {
+        cerrar();
+        return false;
+    }
+    madvise(p, tamanio, MADV_SEQUENTIAL);
+    datos = static_cast<const char*>(p);
+#endif
+    return true;
+}
+
+/**
+ * @brief Libera la proyección y cierra el archivo, dejando el objeto reutilizable.
+ */
+void ArchivoMapeado::cerrar() {
+#ifdef _WIN32
+    if (datos) UnmapViewOfFile(datos);
+    if (mapeo) CloseHandle(mapeo);
+    if (archivo != INVALID_HANDLE_VALUE) CloseHandle(archivo);
+    mapeo = nullptr;
+    archivo = INVALID_HANDLE_VALUE;
+#else
+    if (datos) munmap(const_cast<char*>(datos), tamanio);
+    if (descriptor >= 0) ::close(descriptor);
+    descriptor = -1;
+#endif
+    datos = nullptr;
+    tamanio = 0;
+    abierto = false;
+}
+
+/**
+ * @brief Indica si hay un archivo abierto.
+ *
+ * @return true si abrir() tuvo éxito y el archivo no se ha cerrado.
+ */
+bool ArchivoMapeado::estaAbierto() const {
+    return abierto;
+}
+
+/**
+ * @brief Obtiene la vista sobre el contenido proyectado.
+ *
+ * @return Vista de los bytes del archivo; vacía si no hay archivo o está vacío.
+ */
+std::string_view ArchivoMapeado::getContenido() const {
+    return datos ? std::string_view(datos, tamanio) : std::string_view();
+}
@@ -0,0 +1,73 @@
+#ifndef ARCHIVO_MAPEADO_H
+#define ARCHIVO_MAPEADO_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * @class ArchivoMapeado
+ * @brief Proyección en memoria de solo lectura de un archivo completo.
+ *
+ * Permite recorrer el contenido de un archivo como un `std::string_view` sin copiarlo
+ * a búferes intermedios: el sistema operativo carga las páginas bajo demanda.
+ * Usa `mmap` en sistemas POSIX y `CreateFileMapping`/`MapViewOfFile` en Windows.
+ * La proyección se libera al cerrar o al destruir el objeto.
+ */
+class ArchivoMapeado {
+private:
+    const char* datos;      ///< Inicio de la proyección (nullptr si el archivo está vacío)
+    size_t tamanio;         ///< Tamaño del archivo en bytes
+    bool abierto;           ///< true si hay un archivo abierto
+#ifdef _WIN32
+    void* archivo;          ///< HANDLE del archivo
+    void* mapeo;            ///< HANDLE del objeto de proyección
+#else
+    int descriptor;         ///< Descriptor del archivo
+#endif
+
+public:
+    /**
+     * @brief Construye un objeto sin archivo asociado.
+     */
+    ArchivoMapeado();
+
+    /**
+     * @brief Libera la proyección y cierra el archivo, si estaba abierto.
+     */
+    ~ArchivoMapeado();
+
+    ArchivoMapeado(const ArchivoMapeado&) = delete;
+    ArchivoMapeado& operator=(const ArchivoMapeado&) = delete;
+
+    /**
+     * @brief Abre un archivo y lo proyecta completo en memoria de solo lectura.
+     *
+     * Un archivo vacío se considera abierto con contenido vacío.
+     *
+     * @param ruta Ruta del archivo.
+     * @return true si el archivo pudo abrirse y proyectarse; false en caso contrario.
+     */
+    bool abrir(const std::string& ruta);
+
+    /**
+     * @brief Libera la proyección y cierra el archivo.
+     */
+    void cerrar();
+
+    /**
+     * @brief Indica si hay un archivo abierto.
+     */
+    bool estaAbierto() const;
+
+    /**
+     * @brief Obtiene el contenido completo del archivo proyectado.
+     *
+     * La vista es válida mientras el archivo siga abierto.
+     *
+     * @return Vista de solo lectura sobre los bytes del archivo.
+     */
+    std::string_view getContenido() const;
+};
+
+#endif // ARCHIVO_MAPEADO_H
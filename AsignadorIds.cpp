@@ -0,0 +1,60 @@
+#include "AsignadorIds.h"
+
+AsignadorIds::AsignadorIds(int capacidad) : generador(std::random_device{}()) {
+    reiniciar(capacidad);
+}
+
+/**
+ * @brief Llena el arreglo de libres con [0, capacidad) y las posiciones con la identidad.
+ */
+void AsignadorIds::reiniciar(int capacidad) {
+    libres.resize(capacidad);
+    posicion.resize(capacidad);
+    for (int i = 0; i < capacidad; i++) {
+        libres[i] = i;
+        posicion[i] = i;
+    }
+}
+
+void AsignadorIds::quitarPosicion(size_t pos) {
+    int32_t id = libres[pos];
+    int32_t ultimo = libres.back();
+    libres[pos] = ultimo;
+    posicion[ultimo] = (int32_t)pos;
+    libres.pop_back();
+    posicion[id] = -1;
+}
+
+bool AsignadorIds::asignar(int& id) {
+    if (libres.empty()) return false;
+    std::uniform_int_distribution<size_t> distribucion(0, libres.size() - 1);
+    size_t pos = distribucion(generador);
+    id = libres[pos];
+    quitarPosicion(pos);
+    return true;
+}
+
+bool AsignadorIds::marcarOcupado(int id) {
+    if (!estaLibre(id)) return false;
+    quitarPosicion((size_t)posicion[id]);
+    return true;
+}
+
+bool AsignadorIds::liberar(int id) {
+    if (id < 0 || id >= getCapacidad() || posicion[id] >= 0) return false;
+    posicion[id] = (int32_t)libres.size();
+    libres.push_back(id);
+    return true;
+}
+
+bool AsignadorIds::estaLibre(int id) const {
+    return id >= 0 && id < getCapacidad() && posicion[id] >= 0;
+}
+
+int AsignadorIds::getCapacidad() const {
+    return (int)posicion.size();
+}
+
+size_t AsignadorIds::getDisponibles() const {
+    return libres.size();
+}
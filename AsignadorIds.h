@@ -0,0 +1,85 @@
+#ifndef ASIGNADOR_IDS_H
+#define ASIGNADOR_IDS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/**
+ * @class AsignadorIds
+ * @brief Reparte IDs de estudiante libres, al azar, en O(1).
+ *
+ * Mantiene los IDs libres de [0, capacidad) en un arreglo denso y, para cada ID, su
+ * posición en ese arreglo (o -1 si está ocupado). Asignar elige una posición al azar y
+ * la intercambia con la última; marcar un ID como ocupado o liberarlo también es un
+ * intercambio, por lo que ninguna operación depende de cuántos IDs estén en uso.
+ * Cuando no quedan IDs, asignar() lo informa en lugar de reintentar.
+ *
+ * La memoria es de 8 bytes por ID del espacio, es decir, 80 KB para los 10000 IDs de
+ * 4 dígitos; por eso la capacidad se limita a CAPACIDAD_MAXIMA (512 MB) aunque la clave del
+ * AVL admita IDs de hasta 2^30.
+ */
+class AsignadorIds {
+private:
+    std::vector<int32_t> libres;     ///< IDs disponibles, sin orden
+    std::vector<int32_t> posicion;   ///< Posición de cada ID en `libres`, o -1 si está ocupado
+    std::mt19937 generador;
+
+    /**
+     * @brief Quita de `libres` la entrada en la posición dada, intercambiándola con la última.
+     */
+    void quitarPosicion(size_t pos);
+
+public:
+    /// Capacidad por omisión: IDs de 4 dígitos, como los de los archivos originales
+    static const int CAPACIDAD_POR_OMISION = 10000;
+
+    /// Capacidad máxima: 2^26 IDs (unos 67 millones), que ocupan 512 MB
+    static const int CAPACIDAD_MAXIMA = 1 << 26;
+
+    /**
+     * @brief Construye un asignador con todos los IDs de [0, capacidad) libres.
+     */
+    explicit AsignadorIds(int capacidad = CAPACIDAD_POR_OMISION);
+
+    /**
+     * @brief Vuelve a dejar libres todos los IDs, con una nueva capacidad.
+     *
+     * @param capacidad Tamaño del espacio de IDs, entre 1 y CAPACIDAD_MAXIMA; lo valida
+     *                  Sistema::setCapacidadIds().
+     */
+    void reiniciar(int capacidad);
+
+    /**
+     * @brief Toma un ID libre elegido al azar con probabilidad uniforme.
+     *
+     * @param id Recibe el ID asignado.
+     * @return false si no quedan IDs libres.
+     */
+    bool asignar(int& id);
+
+    /**
+     * @brief Marca como ocupado un ID asignado por otra vía (por ejemplo, al cargar los datos).
+     *
+     * @return true si el ID estaba libre; los IDs fuera de la capacidad se ignoran.
+     */
+    bool marcarOcupado(int id);
+
+    /**
+     * @brief Devuelve un ID al conjunto de libres.
+     *
+     * @return true si el ID estaba ocupado y dentro de la capacidad.
+     */
+    bool liberar(int id);
+
+    /**
+     * @brief Indica si un ID está dentro de la capacidad y libre.
+     */
+    bool estaLibre(int id) const;
+
+    int getCapacidad() const;
+    size_t getDisponibles() const;
+};
+
+#endif // ASIGNADOR_IDS_H
@@ -0,0 +1,258 @@
+#include "BitacoraCambios.h"
+#include "Snapshot.h"
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+
+namespace {
+
+// Largo máximo aceptado para el contenido de un registro; protege la lectura de largos dañados
+const uint32_t MAXIMO_CONTENIDO = 1u << 16;
+
+const size_t BYTES_CABECERA = sizeof(uint32_t) + sizeof(uint8_t);
+const size_t BYTES_SUMA = sizeof(uint64_t);
+
+template <typename T>
+void escribirValor(std::string& salida, T valor) {
+    salida.append(reinterpret_cast<const char*>(&valor), sizeof(T));
+}
+
+// El largo se guarda en 16 bits; un texto más largo no se puede registrar
+bool escribirTexto(std::string& salida, std::string_view texto) {
+    if (texto.size() > UINT16_MAX) return false;
+    escribirValor<uint16_t>(salida, (uint16_t)texto.size());
+    salida.append(texto.data(), texto.size());
+    return true;
+}
+
+template <typename T>
+bool leerValor(std::string_view& entrada, T& valor) {
+    if (entrada.size() < sizeof(T)) return false;
+    std::memcpy(&valor, entrada.data(), sizeof(T));
+    entrada.remove_prefix(sizeof(T));
+    return true;
+}
+
+bool leerTexto(std::string_view& entrada, std::string_view& texto) {
+    uint16_t largo;
+    if (!leerValor(entrada, largo) || entrada.size() < largo) return false;
+    texto = entrada.substr(0, largo);
+    entrada.remove_prefix(largo);
+    return true;
+}
+
+}
+
+BitacoraCambios::BitacoraCambios() : archivo(nullptr), numRegistros(0) {}
+
+BitacoraCambios::~BitacoraCambios() {
+    cerrar();
+}
+
+/**
+ * @brief Abre la bitácora en modo de agregado binario.
+ *
+ * @param rutaArchivo Ruta del archivo.
+ * @param registrosExistentes Registros válidos que ya contiene el archivo.
+ * @return true si el archivo quedó abierto.
+ */
+bool BitacoraCambios::abrir(const std::string& rutaArchivo, size_t registrosExistentes) {
+    cerrar();
+    ruta = rutaArchivo;
+    archivo = std::fopen(ruta.c_str(), "ab");
+    if (!archivo) {
+        std::cerr << "Error al abrir la bitacora " << ruta << "\n";
+        return false;
+    }
+    numRegistros = registrosExistentes;
+    return true;
+}
+
+void BitacoraCambios::cerrar() {
+    if (archivo) {
+        std::fclose(archivo);
+        archivo = nullptr;
+    }
+}
+
+/**
+ * @brief Escribe un registro completo con una sola llamada y lo vacía al sistema operativo.
+ *
+ * Si la escritura falla (disco lleno, error de E/S), el archivo se recorta al tamaño previo:
+ * un registro a medias dejaría inválidos, al reproducir, todos los que se agreguen después.
+ *
+ * @param tipo Tipo del cambio.
+ * @param contenido Contenido ya codificado.
+ * @return true si el registro quedó escrito; si la bitácora no está abierta no se registra nada.
+ */
+bool BitacoraCambios::agregar(TipoCambio tipo, const std::string& contenido) {
+    if (!archivo) return true;
+
+    std::string registro;
+    registro.reserve(BYTES_CABECERA + contenido.size() + BYTES_SUMA);
+    escribirValor<uint32_t>(registro, (uint32_t)contenido.size());
+    escribirValor<uint8_t>(registro, (uint8_t)tipo);
+    registro += contenido;
+    // La suma cubre tipo y contenido, de modo que un registro cortado o alterado se detecta
+    escribirValor<uint64_t>(registro, Snapshot::sumaVerificacion(registro.data() + sizeof(uint32_t),
+                                                                  registro.size() - sizeof(uint32_t)));
+
+    const long tamanioPrevio = std::ftell(archivo);
+    if (std::fwrite(registro.data(), 1, registro.size(), archivo) != registro.size() ||
+        std::fflush(archivo) != 0) {
+        std::cerr << "Error al escribir en la bitacora " << ruta << "\n";
+        cerrar();
+        std::error_code ec;
+        if (tamanioPrevio >= 0) std::filesystem::resize_file(ruta, (uintmax_t)tamanioPrevio, ec);
+        abrir(ruta, numRegistros);
+        return false;
+    }
+    numRegistros++;
+    return true;
+}
+
+/**
+ * @brief Registra una matrícula con todos los datos necesarios para reconstruir al estudiante.
+ *
+ * @param est Estudiante recién matriculado.
+ * @return true si el registro quedó escrito.
+ */
+bool BitacoraCambios::registrarMatricula(const Estudiante& est) {
+    std::string contenido;
+    escribirValor<int32_t>(contenido, est.getId());
+    escribirValor<int16_t>(contenido, (int16_t)est.getAnio());
+    escribirValor<uint8_t>(contenido, (uint8_t)est.getMes());
+    escribirValor<uint8_t>(contenido, (uint8_t)est.getDia());
+    escribirValor<uint8_t>(contenido, (uint8_t)est.getHora());
+    escribirValor<uint8_t>(contenido, (uint8_t)est.getMinuto());
+    if (!escribirTexto(contenido, est.getNombre())) {
+        std::cerr << "Nombre demasiado largo para la bitacora " << ruta << "\n";
+        return false;
+    }
+    escribirValor<uint8_t>(contenido, (uint8_t)est.getNumPreferencias());
+    for (int i = 0; i < est.getNumPreferencias(); i++) {
+        escribirValor<uint8_t>(contenido, (uint8_t)est.getEstiloPreferencia(i));
+    }
+    return agregar(TipoCambio::MatriculaEstudiante, contenido);
+}
+
+/**
+ * @brief Registra la eliminación de un instructor por su ID.
+ *
+ * @param id ID del instructor eliminado.
+ * @return true si el registro quedó escrito.
+ */
+bool BitacoraCambios::registrarEliminacionInstructor(int id) {
+    std::string contenido;
+    escribirValor<int32_t>(contenido, id);
+    return agregar(TipoCambio::EliminacionInstructor, contenido);
+}
+
+/**
+ * @brief Registra la eliminación de un estudiante por su ID.
+ *
+ * @param id ID del estudiante eliminado.
+ * @return true si el registro quedó escrito.
+ */
+bool BitacoraCambios::registrarEliminacionEstudiante(int id) {
+    std::string contenido;
+    escribirValor<int32_t>(contenido, id);
+    return agregar(TipoCambio::EliminacionEstudiante, contenido);
+}
+
+/**
+ * @brief Trunca la bitácora a cero bytes y la deja abierta para seguir agregando.
+ *
+ * @return true si la bitácora quedó vacía.
+ */
+bool BitacoraCambios::vaciar() {
+    if (ruta.empty()) return false;
+    cerrar();
+    std::FILE* vacio = std::fopen(ruta.c_str(), "wb");
+    if (!vacio) {
+        std::cerr << "Error al vaciar la bitacora " << ruta << "\n";
+        return false;
+    }
+    std::fclose(vacio);
+    return abrir(ruta, 0);
+}
+
+size_t BitacoraCambios::getNumRegistros() const {
+    return numRegistros;
+}
+
+/**
+ * @brief Decodifica el contenido de un registro según su tipo.
+ *
+ * @param tipo Tipo leído de la cabecera.
+ * @param contenido Bytes del contenido.
+ * @param cambio Recibe el cambio decodificado.
+ * @return true si el contenido es válido y se consumió completo.
+ */
+bool BitacoraCambios::decodificar(TipoCambio tipo, std::string_view contenido, CambioBitacora& cambio) {
+    cambio = CambioBitacora{};
+    cambio.tipo = tipo;
+
+    int32_t id;
+    if (!leerValor(contenido, id)) return false;
+    cambio.id = id;
+
+    switch (tipo) {
+        case TipoCambio::MatriculaEstudiante: {
+            int16_t anio;
+            uint8_t mes, dia, hora, minuto, numPreferencias;
+            if (!leerValor(contenido, anio) || !leerValor(contenido, mes) || !leerValor(contenido, dia) ||
+                !leerValor(contenido, hora) || !leerValor(contenido, minuto) ||
+                !leerTexto(contenido, cambio.nombre) || !leerValor(contenido, numPreferencias) ||
+                numPreferencias > 3) {
+                return false;
+            }
+            cambio.anio = anio;
+            cambio.mes = mes;
+            cambio.dia = dia;
+            cambio.hora = hora;
+            cambio.minuto = minuto;
+            cambio.numPreferencias = 0;
+            for (int i = 0; i < numPreferencias; i++) {
+                uint8_t codigo;
+                if (!leerValor(contenido, codigo) || !codigoEstiloValido(codigo)) return false;
+                cambio.preferencias[cambio.numPreferencias++] = (EstiloBaile)codigo;
+            }
+            break;
+        }
+        case TipoCambio::EliminacionInstructor:
+        case TipoCambio::EliminacionEstudiante:
+            break;
+        default:
+            return false;
+    }
+    return contenido.empty();
+}
+
+/**
+ * @brief Lee y valida el registro que comienza en `pos`.
+ *
+ * @param datos Contenido completo de la bitácora.
+ * @param pos Posición del registro; avanza al siguiente si la lectura es válida.
+ * @param cambio Recibe el cambio decodificado.
+ * @return true si el registro estaba completo, con suma correcta y contenido coherente.
+ */
+bool BitacoraCambios::leerRegistro(std::string_view datos, size_t& pos, CambioBitacora& cambio) {
+    if (datos.size() - pos < BYTES_CABECERA + BYTES_SUMA) return false;
+
+    uint32_t largo;
+    std::memcpy(&largo, datos.data() + pos, sizeof(largo));
+    if (largo > MAXIMO_CONTENIDO || datos.size() - pos < BYTES_CABECERA + largo + BYTES_SUMA) return false;
+
+    const char* cubierto = datos.data() + pos + sizeof(uint32_t);
+    const size_t bytesCubiertos = sizeof(uint8_t) + largo;
+    uint64_t suma;
+    std::memcpy(&suma, cubierto + bytesCubiertos, sizeof(suma));
+    if (suma != Snapshot::sumaVerificacion(cubierto, bytesCubiertos)) return false;
+
+    TipoCambio tipo = (TipoCambio)(uint8_t)cubierto[0];
+    if (!decodificar(tipo, std::string_view(cubierto + 1, largo), cambio)) return false;
+
+    pos += BYTES_CABECERA + largo + BYTES_SUMA;
+    return true;
+}
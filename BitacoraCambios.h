@@ -0,0 +1,161 @@
+#ifndef BITACORA_CAMBIOS_H
+#define BITACORA_CAMBIOS_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include "ArchivoMapeado.h"
+#include "Estudiante.h"
+
+/**
+ * @brief Tipos de cambio que se registran en la bitácora.
+ */
+enum class TipoCambio : uint8_t {
+    MatriculaEstudiante = 1,        ///< Preferencias como códigos de EstiloBaile
+    EliminacionInstructor = 2,
+    EliminacionEstudiante = 3
+};
+
+/**
+ * @brief Cambio leído de la bitácora. Los textos son vistas sobre el archivo leído.
+ */
+struct CambioBitacora {
+    TipoCambio tipo;
+    int id;                             ///< ID del estudiante o instructor afectado
+    int dia, mes, anio, hora, minuto;   ///< Fecha de matrícula (solo matrículas)
+    std::string_view nombre;            ///< Nombre del estudiante (solo matrículas)
+    EstiloBaile preferencias[3];        ///< Preferencias (solo matrículas)
+    int numPreferencias;
+};
+
+/**
+ * @class BitacoraCambios
+ * @brief Registro de escritura anticipada (write-ahead log) de los cambios hechos desde el último snapshot.
+ *
+ * Cada operación que modifica los datos se agrega al final del archivo como un registro
+ * compacto: largo del contenido (4 bytes), tipo (1 byte), contenido y suma de verificación
+ * (8 bytes). El registro se vacía al sistema operativo antes de confirmar la operación, de
+ * modo que una caída del proceso no pierde cambios ya informados al usuario.
+ *
+ * Al iniciar, los registros se reproducen sobre el último snapshot; un registro final
+ * incompleto o dañado (por una caída a mitad de escritura) se descarta. La compactación
+ * consiste en escribir un snapshot nuevo y vaciar la bitácora.
+ */
+class BitacoraCambios {
+private:
+    std::FILE* archivo;         ///< Archivo abierto para agregar, o nullptr
+    std::string ruta;           ///< Ruta del archivo de bitácora
+    size_t numRegistros;        ///< Registros presentes en el archivo
+
+    /**
+     * @brief Agrega un registro completo (cabecera, contenido y suma) y lo vacía al sistema operativo.
+     */
+    bool agregar(TipoCambio tipo, const std::string& contenido);
+
+public:
+    BitacoraCambios();
+    ~BitacoraCambios();
+
+    BitacoraCambios(const BitacoraCambios&) = delete;
+    BitacoraCambios& operator=(const BitacoraCambios&) = delete;
+
+    /**
+     * @brief Abre (o crea) la bitácora para agregar registros.
+     *
+     * @param rutaArchivo Ruta del archivo.
+     * @param registrosExistentes Registros válidos ya presentes (por ejemplo, los reproducidos).
+     * @return true si el archivo quedó abierto.
+     */
+    bool abrir(const std::string& rutaArchivo, size_t registrosExistentes);
+
+    /**
+     * @brief Cierra el archivo de la bitácora.
+     */
+    void cerrar();
+
+    /**
+     * @brief Registra la matrícula de un estudiante con todos sus datos.
+     *
+     * @return true si el registro quedó escrito (o si la bitácora no está abierta).
+     */
+    bool registrarMatricula(const Estudiante& est);
+
+    /**
+     * @brief Registra la eliminación de un instructor.
+     *
+     * @return true si el registro quedó escrito (o si la bitácora no está abierta).
+     */
+    bool registrarEliminacionInstructor(int id);
+
+    /**
+     * @brief Registra la eliminación de un estudiante.
+     *
+     * @return true si el registro quedó escrito (o si la bitácora no está abierta).
+     */
+    bool registrarEliminacionEstudiante(int id);
+
+    /**
+     * @brief Vacía la bitácora; se usa después de escribir un snapshot que ya contiene sus cambios.
+     *
+     * @return true si el archivo quedó vacío y abierto.
+     */
+    bool vaciar();
+
+    /**
+     * @brief Obtiene la cantidad de registros acumulados desde la última compactación.
+     */
+    size_t getNumRegistros() const;
+
+    /**
+     * @brief Reproduce los registros válidos de una bitácora, en orden.
+     *
+     * La lectura se detiene en el primer registro incompleto o con suma incorrecta, que
+     * corresponde a una escritura interrumpida.
+     *
+     * @param rutaArchivo Ruta de la bitácora.
+     * @param aplicar Función invocada como `aplicar(const CambioBitacora&)` por cada registro.
+     * @param descartados Recibe true si hubo un final dañado que se descartó.
+     * @return Número de registros reproducidos.
+     */
+    template <typename Funcion>
+    static size_t reproducir(const std::string& rutaArchivo, Funcion&& aplicar, bool& descartados);
+
+private:
+    /**
+     * @brief Decodifica el contenido de un registro.
+     *
+     * @return true si el contenido es coherente con su tipo.
+     */
+    static bool decodificar(TipoCambio tipo, std::string_view contenido, CambioBitacora& cambio);
+
+    /**
+     * @brief Lee el registro que comienza en `pos` y avanza `pos` hasta el siguiente.
+     *
+     * @return true si había un registro completo y válido.
+     */
+    static bool leerRegistro(std::string_view datos, size_t& pos, CambioBitacora& cambio);
+};
+
+template <typename Funcion>
+size_t BitacoraCambios::reproducir(const std::string& rutaArchivo, Funcion&& aplicar, bool& descartados) {
+    descartados = false;
+    ArchivoMapeado archivo;
+    if (!archivo.abrir(rutaArchivo)) return 0;
+    std::string_view datos = archivo.getContenido();
+
+    size_t pos = 0;
+    size_t reproducidos = 0;
+    CambioBitacora cambio;
+    while (pos < datos.size()) {
+        if (!leerRegistro(datos, pos, cambio)) {
+            descartados = true;
+            break;
+        }
+        aplicar(cambio);
+        reproducidos++;
+    }
+    return reproducidos;
+}
+
+#endif // BITACORA_CAMBIOS_H
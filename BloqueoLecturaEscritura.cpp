@@ -0,0 +1,39 @@
+#include "BloqueoLecturaEscritura.h"
+
+BloqueoLecturaEscritura::BloqueoLecturaEscritura()
+    : lectoresActivos(0), escritoresEsperando(0), escritorActivo(false) {}
+
+void BloqueoLecturaEscritura::lock_shared() {
+    std::unique_lock<std::mutex> guardia(mutex);
+    puedenLeer.wait(guardia, [this] { return !escritorActivo && escritoresEsperando == 0; });
+    lectoresActivos++;
+}
+
+/**
+ * @brief Suelta el bloqueo compartido; el último lector despierta a un escritor en espera.
+ */
+void BloqueoLecturaEscritura::unlock_shared() {
+    std::lock_guard<std::mutex> guardia(mutex);
+    if (--lectoresActivos == 0 && escritoresEsperando > 0) puedeEscribir.notify_one();
+}
+
+void BloqueoLecturaEscritura::lock() {
+    std::unique_lock<std::mutex> guardia(mutex);
+    escritoresEsperando++;
+    puedeEscribir.wait(guardia, [this] { return !escritorActivo && lectoresActivos == 0; });
+    escritoresEsperando--;
+    escritorActivo = true;
+}
+
+/**
+ * @brief Suelta el bloqueo exclusivo: pasa a otro escritor en espera o, si no hay, a todos los lectores.
+ */
+void BloqueoLecturaEscritura::unlock() {
+    std::lock_guard<std::mutex> guardia(mutex);
+    escritorActivo = false;
+    if (escritoresEsperando > 0) {
+        puedeEscribir.notify_one();
+    } else {
+        puedenLeer.notify_all();
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef BLOQUEO_LECTURA_ESCRITURA_H
+#define BLOQUEO_LECTURA_ESCRITURA_H
+
+#include <condition_variable>
+#include <mutex>
+
+/**
+ * @class BloqueoLecturaEscritura
+ * @brief Bloqueo de lectores y escritores que da prioridad a los escritores.
+ *
+ * Varios lectores pueden tenerlo a la vez; un escritor lo tiene solo. Mientras haya un
+ * escritor esperando, los lectores nuevos se duermen en lugar de entrar, de modo que una
+ * ráfaga continua de consultas no posterga las escrituras indefinidamente (el
+ * std::shared_mutex de glibc prefiere a los lectores). La espera es con variables de
+ * condición, sin ocupar el procesador.
+ *
+ * Cumple con los requisitos de SharedMutex, por lo que se usa con std::shared_lock y
+ * std::unique_lock. No es recursivo.
+ */
+class BloqueoLecturaEscritura {
+private:
+    std::mutex mutex;
+    std::condition_variable puedenLeer;     ///< Avisa a los lectores que ya no hay escritores
+    std::condition_variable puedeEscribir;  ///< Avisa a un escritor que el bloqueo quedó libre
+    int lectoresActivos;
+    int escritoresEsperando;
+    bool escritorActivo;
+
+public:
+    BloqueoLecturaEscritura();
+
+    BloqueoLecturaEscritura(const BloqueoLecturaEscritura&) = delete;
+    BloqueoLecturaEscritura& operator=(const BloqueoLecturaEscritura&) = delete;
+
+    /**
+     * @brief Toma el bloqueo compartido; espera si hay un escritor activo o esperando.
+     */
+    void lock_shared();
+
+    void unlock_shared();
+
+    /**
+     * @brief Toma el bloqueo exclusivo; desde que empieza a esperar no entran lectores nuevos.
+     */
+    void lock();
+
+    void unlock();
+};
+
+#endif // BLOQUEO_LECTURA_ESCRITURA_H
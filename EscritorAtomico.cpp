@@ -0,0 +1,172 @@
+#include "EscritorAtomico.h"
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+/**
+ * @brief Fuerza a disco el contenido de un archivo abierto.
+ */
+bool sincronizar(std::FILE* archivo) {
+    if (std::fflush(archivo) != 0) return false;
+#ifdef _WIN32
+    return _commit(_fileno(archivo)) == 0;
+#else
+    return fsync(fileno(archivo)) == 0;
+#endif
+}
+
+/**
+ * @brief Sincroniza el directorio que contiene `ruta`, para que el renombrado sobreviva a una caída.
+ *
+ * En Windows el renombrado queda registrado por el sistema de archivos y no hay equivalente.
+ */
+void sincronizarDirectorio(const std::string& ruta) {
+#ifndef _WIN32
+    std::filesystem::path directorio = std::filesystem::path(ruta).parent_path();
+    if (directorio.empty()) directorio = ".";
+    int descriptor = open(directorio.c_str(), O_RDONLY);
+    if (descriptor >= 0) {
+        fsync(descriptor);
+        close(descriptor);
+    }
+#else
+    (void)ruta;
+#endif
+}
+
+}
+
+EscritorAtomico::EscritorAtomico() : usado(0), archivo(nullptr), fallo(false) {}
+
+EscritorAtomico::~EscritorAtomico() {
+    descartar();
+}
+
+/**
+ * @brief Crea el archivo temporal "<ruta>.tmp" y prepara el búfer.
+ *
+ * @param ruta Archivo de destino.
+ * @return true si el temporal se creó.
+ */
+bool EscritorAtomico::abrir(const std::string& ruta) {
+    descartar();
+    rutaDestino = ruta;
+    rutaTemporal = ruta + ".tmp";
+    archivo = std::fopen(rutaTemporal.c_str(), "wb");
+    if (!archivo) return false;
+    // El búfer propio reemplaza al de stdio
+    std::setvbuf(archivo, nullptr, _IONBF, 0);
+    buffer.resize(CAPACIDAD_BUFFER);
+    usado = 0;
+    fallo = false;
+    return true;
+}
+
+void EscritorAtomico::vaciarBuffer() {
+    if (usado == 0) return;
+    if (!archivo || std::fwrite(buffer.data(), 1, usado, archivo) != usado) fallo = true;
+    usado = 0;
+}
+
+char* EscritorAtomico::reservar(size_t n) {
+    if (buffer.size() - usado < n) {
+        vaciarBuffer();
+        if (buffer.size() < n) buffer.resize(n);
+    }
+    return buffer.data() + usado;
+}
+
+void EscritorAtomico::escribir(std::string_view texto) {
+    // Los textos más grandes que el búfer se escriben directo, sin copiarlos
+    if (texto.size() > buffer.size()) {
+        vaciarBuffer();
+        if (!archivo || std::fwrite(texto.data(), 1, texto.size(), archivo) != texto.size()) fallo = true;
+        return;
+    }
+    std::memcpy(reservar(texto.size()), texto.data(), texto.size());
+    usado += texto.size();
+}
+
+void EscritorAtomico::escribir(char c) {
+    *reservar(1) = c;
+    usado++;
+}
+
+void EscritorAtomico::escribirEntero(long long valor) {
+    char* inicio = reservar(24);
+    usado = std::to_chars(inicio, inicio + 24, valor).ptr - buffer.data();
+}
+
+void EscritorAtomico::escribirEnteroFijo(unsigned valor, int ancho) {
+    char* inicio = reservar((size_t)ancho);
+    for (int i = ancho - 1; i >= 0; i--) {
+        inicio[i] = (char)('0' + valor % 10);
+        valor /= 10;
+    }
+    usado += (size_t)ancho;
+}
+
+void EscritorAtomico::escribirReal(double valor) {
+    char* inicio = reservar(32);
+    // Notación fija (800000, no 8e+05); solo los valores que no caben en 32 caracteres usan exponente
+    std::to_chars_result r = std::to_chars(inicio, inicio + 32, valor, std::chars_format::fixed);
+    if (r.ec != std::errc()) r = std::to_chars(inicio, inicio + 32, valor);
+    usado = r.ptr - buffer.data();
+}
+
+/**
+ * @brief Completa la escritura y reemplaza el destino.
+ *
+ * Orden: volcar el búfer, sincronizar el temporal, cerrarlo, renombrarlo sobre el
+ * destino y sincronizar el directorio. Ante cualquier falla se elimina el temporal.
+ *
+ * @param error Causa de la falla, si la hubo.
+ * @return true si el destino quedó reemplazado.
+ */
+bool EscritorAtomico::confirmar(std::string& error) {
+    if (!archivo) {
+        error = "no hay archivo abierto";
+        return false;
+    }
+    vaciarBuffer();
+    if (fallo || !sincronizar(archivo)) {
+        error = "error al escribir " + rutaTemporal;
+        descartar();
+        return false;
+    }
+    std::fclose(archivo);
+    archivo = nullptr;
+
+    std::error_code ec;
+    std::filesystem::rename(rutaTemporal, rutaDestino, ec);
+    if (ec) {
+        error = "no se pudo reemplazar " + rutaDestino + ": " + ec.message();
+        descartar();
+        return false;
+    }
+    sincronizarDirectorio(rutaDestino);
+    rutaTemporal.clear();
+    return true;
+}
+
+void EscritorAtomico::descartar() {
+    if (archivo) {
+        std::fclose(archivo);
+        archivo = nullptr;
+    }
+    if (!rutaTemporal.empty()) {
+        std::error_code ec;
+        std::filesystem::remove(rutaTemporal, ec);
+        rutaTemporal.clear();
+    }
+    usado = 0;
+}
@@ -0,0 +1,103 @@
+#ifndef ESCRITOR_ATOMICO_H
+#define ESCRITOR_ATOMICO_H
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class EscritorAtomico
+ * @brief Escritura con búfer propio que reemplaza un archivo de forma atómica.
+ *
+ * Los datos se formatean en un búfer grande reutilizable (los números con
+ * `std::to_chars`, sin flujos) y se vuelcan a un archivo temporal junto al destino.
+ * Al confirmar, el temporal se sincroniza a disco (`fsync`, o `_commit` en Windows) y
+ * se renombra sobre el destino, de modo que una caída a mitad de la escritura deja
+ * intacto el archivo anterior. Si el objeto se destruye sin confirmar, el temporal
+ * se elimina.
+ */
+class EscritorAtomico {
+private:
+    std::vector<char> buffer;   ///< Búfer de formato
+    size_t usado;               ///< Bytes pendientes en el búfer
+    std::FILE* archivo;         ///< Archivo temporal abierto, o nullptr
+    std::string rutaDestino;    ///< Archivo que se reemplaza al confirmar
+    std::string rutaTemporal;   ///< Archivo donde se escribe mientras tanto
+    bool fallo;                 ///< true si alguna escritura falló
+
+    /**
+     * @brief Vuelca el búfer al archivo temporal.
+     */
+    void vaciarBuffer();
+
+    /**
+     * @brief Garantiza espacio contiguo para `n` bytes en el búfer y devuelve dónde escribirlos.
+     */
+    char* reservar(size_t n);
+
+public:
+    /// Capacidad del búfer de formato (1 MiB)
+    static const size_t CAPACIDAD_BUFFER = 1 << 20;
+
+    EscritorAtomico();
+
+    /**
+     * @brief Descarta el archivo temporal si no se confirmó.
+     */
+    ~EscritorAtomico();
+
+    EscritorAtomico(const EscritorAtomico&) = delete;
+    EscritorAtomico& operator=(const EscritorAtomico&) = delete;
+
+    /**
+     * @brief Comienza a escribir el reemplazo de un archivo.
+     *
+     * @param ruta Ruta del archivo que se reemplazará al confirmar.
+     * @return true si el archivo temporal pudo crearse.
+     */
+    bool abrir(const std::string& ruta);
+
+    /**
+     * @brief Agrega texto tal cual.
+     */
+    void escribir(std::string_view texto);
+
+    /**
+     * @brief Agrega un carácter.
+     */
+    void escribir(char c);
+
+    /**
+     * @brief Agrega un entero en decimal.
+     */
+    void escribirEntero(long long valor);
+
+    /**
+     * @brief Agrega un entero no negativo con exactamente `ancho` dígitos, rellenando con ceros.
+     *
+     * Pensado para campos de ancho fijo como fechas y horas.
+     */
+    void escribirEnteroFijo(unsigned valor, int ancho);
+
+    /**
+     * @brief Agrega un número real en notación fija, con los decimales mínimos que lo reproducen exactamente.
+     */
+    void escribirReal(double valor);
+
+    /**
+     * @brief Vuelca lo pendiente, sincroniza el temporal a disco y lo renombra sobre el destino.
+     *
+     * @param error Recibe la causa si la operación falla; en ese caso el destino no cambia.
+     * @return true si el destino quedó reemplazado.
+     */
+    bool confirmar(std::string& error);
+
+    /**
+     * @brief Cierra y elimina el archivo temporal sin tocar el destino.
+     */
+    void descartar();
+};
+
+#endif // ESCRITOR_ATOMICO_H
@@ -0,0 +1,57 @@
+#include "EstiloBaile.h"
+#include <cctype>
+
+namespace {
+
+const std::string NOMBRES_ESTILOS[NUM_ESTILOS_BAILE] = {
+    "Bachata", "Reggaeton", "Salsa", "Cumbia", "Tango"
+};
+
+}
+
+/**
+ * @brief Obtiene el nombre de un estilo desde la tabla estática de nombres.
+ *
+ * @param estilo Estilo válido.
+ * @return Nombre del estilo.
+ */
+const std::string& nombreEstilo(EstiloBaile estilo) {
+    return NOMBRES_ESTILOS[(unsigned)estilo];
+}
+
+/**
+ * @brief Busca un nombre de estilo en la tabla, comparando sin distinguir mayúsculas.
+ *
+ * @param texto Nombre leído.
+ * @param estilo Recibe el estilo si se reconoce.
+ * @return true si se reconoció.
+ */
+bool estiloDesdeTexto(std::string_view texto, EstiloBaile& estilo) {
+    for (int i = 0; i < NUM_ESTILOS_BAILE; i++) {
+        const std::string& nombre = NOMBRES_ESTILOS[i];
+        if (nombre.size() != texto.size()) continue;
+        size_t j = 0;
+        while (j < texto.size() &&
+               std::tolower((unsigned char)texto[j]) == std::tolower((unsigned char)nombre[j])) {
+            j++;
+        }
+        if (j == texto.size()) {
+            estilo = (EstiloBaile)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Recorre los conteos y se queda con el primer máximo.
+ */
+EstiloBaile estiloMasPopular(const size_t conteos[NUM_ESTILOS_BAILE]) {
+    int maxIndex = 0;
+    for (int i = 1; i < NUM_ESTILOS_BAILE; ++i) {
+        if (conteos[i] > conteos[maxIndex]) {
+            maxIndex = i;
+        }
+    }
+    return (EstiloBaile)maxIndex;
+}
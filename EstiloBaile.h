@@ -0,0 +1,65 @@
+#ifndef ESTILO_BAILE_H
+#define ESTILO_BAILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Estilos de baile que ofrece la academia.
+ *
+ * El valor de cada estilo es su posición de bit en las máscaras de preferencias
+ * (ver bitEstilo()). Los nombres de texto solo se usan al leer o escribir datos.
+ */
+enum class EstiloBaile : uint8_t {
+    Bachata = 0,
+    Reggaeton = 1,
+    Salsa = 2,
+    Cumbia = 3,
+    Tango = 4
+};
+
+/// Cantidad de estilos de baile distintos
+const int NUM_ESTILOS_BAILE = 5;
+
+/**
+ * @brief Bit que representa un estilo dentro de una máscara de preferencias.
+ */
+inline uint8_t bitEstilo(EstiloBaile estilo) {
+    return (uint8_t)(1u << (unsigned)estilo);
+}
+
+/**
+ * @brief Nombre de un estilo, por ejemplo "Reggaeton".
+ *
+ * @param estilo Estilo válido.
+ * @return Referencia a una cadena estática.
+ */
+const std::string& nombreEstilo(EstiloBaile estilo);
+
+/**
+ * @brief Reconoce el nombre de un estilo sin distinguir mayúsculas de minúsculas.
+ *
+ * @param texto Nombre a reconocer.
+ * @param estilo Recibe el estilo reconocido.
+ * @return true si el texto corresponde a un estilo.
+ */
+bool estiloDesdeTexto(std::string_view texto, EstiloBaile& estilo);
+
+/**
+ * @brief Estilo con el conteo más alto; ante un empate gana el primero en el orden de EstiloBaile.
+ *
+ * @param conteos Cantidad de estudiantes que prefieren cada estilo, indexada por EstiloBaile.
+ * @return El estilo más popular (Bachata si todos los conteos son cero).
+ */
+EstiloBaile estiloMasPopular(const size_t conteos[NUM_ESTILOS_BAILE]);
+
+/**
+ * @brief Verifica que un código numérico leído de un archivo corresponda a un estilo.
+ */
+inline bool codigoEstiloValido(unsigned codigo) {
+    return codigo < (unsigned)NUM_ESTILOS_BAILE;
+}
+
+#endif // ESTILO_BAILE_H
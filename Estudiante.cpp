@@ -4,6 +4,7 @@
 #include <iomanip>
 #include <cctype>
 #include <cstring>
+#include <charconv>
 
 
 /**
@@ -13,7 +14,7 @@
  * `nombreCompleto` se inicializa como una cadena vacía y `fechaMatricula` se
  * inicializa como "01/01/1970 00:00". El número de preferencias se establece en 0,
  * y la fecha y hora se configuran con los valores por defecto 1/1/1970 00:00.
- * El arreglo de preferencias se limpia.
+ * La lista y la máscara de preferencias quedan vacías.
  *
  * @return Un objeto Estudiante completamente inicializado con valores por defecto.
  */
@@ -21,12 +22,11 @@ Estudiante::Estudiante()
     : id(0),
       nombreCompleto(""),
       fechaMatricula("01/01/1970 00:00"),
+      preferencias{},
       numPreferencias(0),
+      mascaraPreferencias(0),
       dia(1), mes(1), anio(1970), hora(0), minuto(0)
 {
-    for (int i = 0; i < 3; i++) {
-        preferencias[i].clear();
-    }
 }
 
 /**
@@ -35,7 +35,7 @@ Estudiante::Estudiante()
  * Inicializa un objeto Estudiante con los valores proporcionados.
  * Asigna un identificador único, nombre completo, fecha de matrícula
  * y una lista de preferencias. Se procesan un máximo de 3 preferencias,
- * y las preferencias restantes se dejan vacías si no se proporcionan.
+ * que se codifican como estilos de baile; los nombres no reconocidos se omiten.
  * Además, analiza la fecha de matrícula para separar sus componentes.
  *
  * @param id Identificador único del estudiante.
@@ -49,17 +49,10 @@ Estudiante::Estudiante()
 Estudiante::Estudiante(int id,const std::string& nombreCompleto,const std::string& fechaMatricula,const std::string prefs[],int nPrefs)
     : id(id),
       nombreCompleto(nombreCompleto),
-      fechaMatricula(fechaMatricula),
-      numPreferencias(nPrefs)
+      fechaMatricula(fechaMatricula)
 {
-    // Copiar hasta 3 preferencias
-    for (int i = 0; i < 3; i++) {
-        if (i < nPrefs) {
-            preferencias[i] = prefs[i];
-        } else {
-            preferencias[i].clear();
-        }
-    }
+    // Codificar hasta 3 preferencias
+    setPreferencias(prefs, nPrefs);
     // Obtener campos separados de la fecha
     parsearFecha(fechaMatricula);
 }
@@ -69,9 +62,8 @@ Estudiante::Estudiante(int id,const std::string& nombreCompleto,const std::strin
  *
  * Inicializa un objeto Estudiante utilizando los parámetros proporcionados. Establece
  * el `id`, el `nombreCompleto`, la fecha y hora de matrícula (`dia`, `mes`, `anio`, `hora`, `minuto`)
- * y copia hasta tres preferencias del arreglo `prefs` en el atributo correspondiente.
- * Si el número de preferencias proporcionadas es menor a tres, los elementos restantes
- * se inicializan como cadenas vacías. También configura la cadena `fechaMatricula`
+ * y codifica hasta tres preferencias del arreglo `prefs` como estilos de baile
+ * (los nombres no reconocidos se omiten). También configura la cadena `fechaMatricula`
  * utilizando el método `formatearFecha`.
  *
  * @param id Identificador único del estudiante.
@@ -93,39 +85,60 @@ Estudiante::Estudiante(int id,const std::string& nombreCompleto,int dia, int mes
     mes(mes),
     anio(anio),
     hora(hora),
-    minuto(minuto),
-    numPreferencias(nPrefs)
+    minuto(minuto)
 {
-    // Copiar hasta 3 preferencias
-    for (int i = 0; i < 3; i++) {
-        if (i < nPrefs) {
-            preferencias[i] = prefs[i];
-        } else {
-            preferencias[i].clear();
-        }
-    }
+    // Codificar hasta 3 preferencias
+    setPreferencias(prefs, nPrefs);
     // Construir cadena fechaMatricula
     formatearFecha();
 }
 
+/**
+ * @brief Constructor de la clase Estudiante a partir de una vista de texto y estilos codificados.
+ *
+ * Equivalente al constructor con fecha separada, pero recibe el nombre como
+ * `std::string_view` y las preferencias ya convertidas a EstiloBaile, de modo que un
+ * cargador pueda construir el estudiante directamente desde los campos de una línea
+ * sin cadenas intermedias.
+ *
+ * @param id Identificador único del estudiante.
+ * @param nombreCompleto Vista del nombre completo del estudiante.
+ * @param dia Día registrado en la fecha de matrícula.
+ * @param mes Mes registrado en la fecha de matrícula.
+ * @param anio Año registrado en la fecha de matrícula.
+ * @param hora Hora registrada en la fecha de matrícula.
+ * @param minuto Minuto registrado en la fecha de matrícula.
+ * @param prefs Arreglo con hasta tres estilos preferidos por el estudiante.
+ * @param nPrefs Número de preferencias proporcionadas en el arreglo `prefs`.
+ */
+Estudiante::Estudiante(int id,std::string_view nombreCompleto,int dia, int mes, int anio,int hora, int minuto,const EstiloBaile prefs[],int nPrefs):
+    id(id),
+    nombreCompleto(nombreCompleto),
+    dia(dia),
+    mes(mes),
+    anio(anio),
+    hora(hora),
+    minuto(minuto)
+{
+    setPreferencias(prefs, nPrefs);
+    formatearFecha();
+}
+
 /**
  * @brief Destructor de la clase Estudiante.
  *
  * Realiza la limpieza de los recursos utilizados por el objeto Estudiante
- * y restablece los valores a su estado inicial. Los campos `nombreCompleto`,
- * `fechaMatricula` y el arreglo de preferencias son limpiados y sus cadenas
- * de texto se vacían. Además, los contadores y valores de fecha y hora se
- * reinician a cero.
+ * y restablece los valores a su estado inicial. Los campos `nombreCompleto` y
+ * `fechaMatricula` son limpiados y sus cadenas de texto se vacían. Además, las
+ * preferencias, los contadores y valores de fecha y hora se reinician a cero.
  */
 Estudiante::~Estudiante() {
     // Limpiar cadenas de texto
     nombreCompleto.clear();
     fechaMatricula.clear();
-    for (int i = 0; i < 3; i++) {
-        preferencias[i].clear();
-    }
     // Restablecer contadores a cero (opcional)
     numPreferencias = 0;
+    mascaraPreferencias = 0;
     dia = mes = anio = hora = minuto = 0;
 }
 
@@ -186,14 +199,36 @@ int Estudiante::getNumPreferencias() const {
  *
  * @param indice El índice de la preferencia que se desea obtener (debe estar en
  * el rango válido de índices del arreglo de preferencias).
- * @return Una referencia constante a la cadena de texto que representa la preferencia
- * almacenada en la posición especificada por el índice.
+ * @return Una referencia constante al nombre del estilo en la posición indicada,
+ * tomado de la tabla estática de nombres de EstiloBaile.
  */
 const std::string& Estudiante::getPreferencia(int indice) const {
     // Se asume 0 <= indice < numPreferencias
+    return nombreEstilo(preferencias[indice]);
+}
+
+/**
+ * @brief Obtiene el estilo codificado de la preferencia en la posición indicada.
+ *
+ * @param indice Posición de la preferencia (0 ≤ índice < número de preferencias).
+ * @return El estilo de baile correspondiente.
+ */
+EstiloBaile Estudiante::getEstiloPreferencia(int indice) const {
     return preferencias[indice];
 }
 
+/**
+ * @brief Obtiene la máscara de bits de preferencias del estudiante.
+ *
+ * Cada estilo preferido tiene encendido su bit bitEstilo(); permite contar o filtrar
+ * preferencias con operaciones de bits en lugar de comparar textos.
+ *
+ * @return La máscara de preferencias.
+ */
+uint8_t Estudiante::getMascaraPreferencias() const {
+    return mascaraPreferencias;
+}
+
 /**
  * @brief Obtiene el valor del día asociado al objeto Estudiante.
  *
@@ -314,10 +349,11 @@ void Estudiante::setFechaMatricula(int d, int m, int a, int h, int min) {
 /**
  * @brief Establece las preferencias del estudiante.
  *
- * Este método asigna las preferencias del estudiante a partir de un arreglo de cadenas.
- * Se limita a las tres primeras preferencias. Si el número de preferencias indicadas
- * excede este límite, solo se toman en cuenta las primeras tres. Si es un número negativo,
- * no se asignan preferencias y estas son limpiadas.
+ * Este método asigna las preferencias del estudiante a partir de un arreglo de cadenas,
+ * que se convierten a EstiloBaile sin distinguir mayúsculas; los nombres no reconocidos
+ * se omiten. Se limita a las tres primeras preferencias. Si el número de preferencias
+ * indicadas excede este límite, solo se toman en cuenta las primeras tres. Si es un
+ * número negativo, no se asignan preferencias y estas son limpiadas.
  *
  * @param prefs Arreglo de cadenas que contiene las preferencias a asignar.
  * @param nPrefs Número de preferencias especificadas en el arreglo.
@@ -325,13 +361,28 @@ void Estudiante::setFechaMatricula(int d, int m, int a, int h, int min) {
  *               serán consideradas.
  */
 void Estudiante::setPreferencias(const std::string prefs[], int nPrefs) {
-    numPreferencias = (nPrefs < 0 ? 0 : (nPrefs > 3 ? 3 : nPrefs));
+    EstiloBaile estilos[3];
+    int nEstilos = 0;
+    for (int i = 0; i < nPrefs && i < 3; i++) {
+        if (estiloDesdeTexto(prefs[i], estilos[nEstilos])) nEstilos++;
+    }
+    setPreferencias(estilos, nEstilos);
+}
+
+/**
+ * @brief Establece las preferencias del estudiante a partir de estilos codificados.
+ *
+ * Guarda hasta tres estilos en el orden dado y recalcula la máscara de preferencias.
+ *
+ * @param prefs Arreglo de estilos.
+ * @param nPrefs Número de estilos en el arreglo (se consideran hasta 3).
+ */
+void Estudiante::setPreferencias(const EstiloBaile prefs[], int nPrefs) {
+    numPreferencias = (uint8_t)(nPrefs < 0 ? 0 : (nPrefs > 3 ? 3 : nPrefs));
+    mascaraPreferencias = 0;
     for (int i = 0; i < 3; i++) {
-        if (i < numPreferencias) {
-            preferencias[i] = prefs[i];
-        } else {
-            preferencias[i].clear();
-        }
+        preferencias[i] = i < numPreferencias ? prefs[i] : EstiloBaile::Bachata;
+        if (i < numPreferencias) mascaraPreferencias |= bitEstilo(prefs[i]);
     }
 }
 
@@ -382,7 +433,7 @@ void Estudiante::convertirPreferenciasATexto(const int numeros[],int nNumeros,st
 std::string Estudiante::getPreferenciasString() const {
     std::string resultado;
     for (int i = 0; i < numPreferencias; i++) {
-        resultado += preferencias[i];
+        resultado += nombreEstilo(preferencias[i]);
         if (i < numPreferencias - 1) {
             resultado += "|";
         }
@@ -410,13 +461,14 @@ std::string Estudiante::getFechaDisplay() const {
  * @brief Valida si el nombre completo del estudiante es válido.
  *
  * Este método verifica que el nombre completo contenga exactamente un espacio
- * entre el primer y segundo nombre, y que no comience ni termine con un espacio.
- * Retorna `true` si el nombre es válido, de lo contrario retorna `false`.
+ * entre el primer y segundo nombre, que no comience ni termine con un espacio y que
+ * no supere LARGO_MAXIMO_NOMBRE bytes. Retorna `true` si el nombre es válido, de lo contrario retorna `false`.
  *
  * @param nombre Una cadena que representa el nombre completo a validar.
  * @return `true` si el nombre completo es válido; `false` en caso contrario.
  */
 bool Estudiante::validarNombreCompleto(const std::string& nombre) {
+    if (nombre.size() > LARGO_MAXIMO_NOMBRE) return false;
     int espacios = 0;
     int n = (int)nombre.size();
     for (int i = 0; i < n; i++) {
@@ -620,17 +672,29 @@ void Estudiante::parsearFecha(const std::string& fechaStr) {
  * @brief Formatea la fecha de matrícula del estudiante en una cadena legible.
  *
  * Este método construye una cadena que representa la fecha de matrícula del estudiante
- * en el formato "MM/DD/YYYY HH:MM". Utiliza manipuladores de flujo para asegurar que los
- * números de mes, día, hora y minuto tengan dos dígitos cuando sea necesario.
+ * en el formato "MM/DD/YYYY HH:MM". Los números de mes, día, hora y minuto se escriben
+ * siempre con dos dígitos y el año con al menos cuatro, directamente en un búfer local,
+ * sin usar flujos, ya que este método se ejecuta por cada estudiante cargado. Es el mismo
+ * formato de estudiantes.csv, por lo que las salidas que muestran la fecha usan este texto.
  */
 void Estudiante::formatearFecha() {
-    std::ostringstream oss;
-    oss << std::setw(2) << std::setfill('0') << mes << "/"
-        << std::setw(2) << std::setfill('0') << dia << "/"
-        << anio << " "
-        << std::setw(2) << std::setfill('0') << hora << ":"
-        << std::setw(2) << std::setfill('0') << minuto;
-    fechaMatricula = oss.str();
+    char buffer[32];
+    char* p = buffer;
+    auto dosDigitos = [&p](int valor) {
+        *p++ = char('0' + (valor / 10) % 10);
+        *p++ = char('0' + valor % 10);
+    };
+    dosDigitos(mes);
+    *p++ = '/';
+    dosDigitos(dia);
+    *p++ = '/';
+    for (int potencia = 1000; potencia > 1 && anio < potencia; potencia /= 10) *p++ = '0';
+    p = std::to_chars(p, buffer + 20, anio).ptr;
+    *p++ = ' ';
+    dosDigitos(hora);
+    *p++ = ':';
+    dosDigitos(minuto);
+    fechaMatricula.assign(buffer, p);
 }
 
 /**
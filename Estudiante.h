@@ -6,12 +6,17 @@
 #define ESTUDIANTE_H
 
 #include <string>
+#include <string_view>
 #include <iostream>
+#include <cstdint>
+#include "EstiloBaile.h"
 
 /*
   Clase que representa un estudiante de la academia de zumba.
   Contiene ID, nombre, fecha de matricula y hasta 3 preferencias de baile,
   asi como campos separados de fecha para comparaciones.
+  Las preferencias se guardan como codigos de EstiloBaile (en el orden indicado)
+  y como una mascara de bits; el texto solo se usa al leer o escribir datos.
 */
 
 class Estudiante {
@@ -19,8 +24,9 @@ private:
     int id;                             // ID unico de 4 digitos
     std::string nombreCompleto;         // Nombre y apellido
     std::string fechaMatricula;         // Formato: "MM/DD/YYYY HH:MM"
-    std::string preferencias[3];        // Hasta 3 estilos de baile
-    int numPreferencias;                // Numero real de preferencias (1..3)
+    EstiloBaile preferencias[3];        // Hasta 3 estilos de baile, en orden
+    uint8_t numPreferencias;            // Numero real de preferencias (1..3)
+    uint8_t mascaraPreferencias;        // Bit bitEstilo(e) encendido por cada estilo preferido
 
     // Campos separados para ordenamiento por fecha
     int dia;    // 1..31
@@ -30,6 +36,9 @@ private:
     int minuto; // 0..59
 
 public:
+    // Largo maximo del nombre completo, en bytes; la bitacora guarda el largo en 16 bits
+    static const size_t LARGO_MAXIMO_NOMBRE = 256;
+
     // Constructor por defecto
     Estudiante();
 
@@ -49,6 +58,15 @@ public:
                const std::string prefs[],
                int nPrefs);
 
+    // Constructor que recibe fecha separada, el nombre como vista de texto (por ejemplo, un
+    // campo de un archivo proyectado en memoria) y las preferencias ya codificadas.
+    Estudiante(int id,
+               std::string_view nombreCompleto,
+               int dia, int mes, int anio,
+               int hora, int minuto,
+               const EstiloBaile prefs[],
+               int nPrefs);
+
     ~Estudiante();
 
     // Getters basicos
@@ -56,7 +74,9 @@ public:
     const std::string& getNombre() const;
     const std::string& getFechaMatricula() const;
     int getNumPreferencias() const;
-    const std::string& getPreferencia(int indice) const;
+    const std::string& getPreferencia(int indice) const;   // Nombre del estilo, desde la tabla estatica
+    EstiloBaile getEstiloPreferencia(int indice) const;
+    uint8_t getMascaraPreferencias() const;
 
     int getDia() const;
     int getMes() const;
@@ -118,6 +138,16 @@ public:
      */
     void setPreferencias(const std::string prefs[], int nPrefs);
 
+    /**
+     * Establece las preferencias de un estudiante a partir de estilos ya codificados.
+     *
+     * Actualiza tanto la lista ordenada como la máscara de bits de preferencias.
+     *
+     * @param prefs Array de estilos a asignar.
+     * @param nPrefs Número de elementos en el array `prefs` (se consideran hasta 3).
+     */
+    void setPreferencias(const EstiloBaile prefs[], int nPrefs);
+
     /**
      * Convierte un array de números a un array de nombres de preferencias y establece la cantidad de preferencias procesadas.
      *
@@ -163,6 +193,8 @@ public:
      * las reglas específicas de validación, como la presencia de caracteres alfabéticos,
      * longitud mínima y formato correcto de nombre y apellido.
      *
+     * El nombre no puede superar LARGO_MAXIMO_NOMBRE bytes.
+     *
      * @param nombre Una cadena que representa el nombre completo a validar.
      * @return `true` si el nombre completo es válido según los criterios establecidos;
      *         `false` en caso contrario.
@@ -0,0 +1,98 @@
+#include "IndiceNombres.h"
+
+namespace {
+
+// Última palabra de un nombre ya normalizado
+std::string_view apellidoDe(std::string_view nombre) {
+    size_t espacio = nombre.rfind(' ');
+    return espacio == std::string_view::npos ? nombre : nombre.substr(espacio + 1);
+}
+
+}
+
+/**
+ * @brief Convierte a minúsculas ASCII y Latin-1 en UTF-8, y deja un solo espacio entre palabras.
+ *
+ * En UTF-8 las mayúsculas À..Þ (salvo ×) son 0xC3 0x80..0x9E y sus minúsculas están
+ * 0x20 más arriba en el segundo byte, igual que en ASCII. Los espacios y tabuladores
+ * iniciales y finales se descartan y cada serie interna se reduce a un espacio.
+ */
+std::string IndiceNombres::normalizar(std::string_view nombre) {
+    std::string resultado;
+    resultado.reserve(nombre.size());
+    bool espacioPendiente = false;
+    for (size_t i = 0; i < nombre.size(); i++) {
+        unsigned char c = (unsigned char)nombre[i];
+        if (c == ' ' || c == '\t') {
+            espacioPendiente = !resultado.empty();
+            continue;
+        }
+        if (espacioPendiente) {
+            resultado += ' ';
+            espacioPendiente = false;
+        }
+        if (c >= 'A' && c <= 'Z') {
+            resultado += char(c + ('a' - 'A'));
+        } else if (c == 0xC3 && i + 1 < nombre.size()) {
+            unsigned char siguiente = (unsigned char)nombre[++i];
+            if (siguiente >= 0x80 && siguiente <= 0x9E && siguiente != 0x97) siguiente += 0x20;
+            resultado += char(c);
+            resultado += char(siguiente);
+        } else {
+            resultado += char(c);
+        }
+    }
+    return resultado;
+}
+
+void IndiceNombres::agregar(std::string_view nombre, bool esEstudiante, int id) {
+    std::string clave = normalizar(nombre);
+    PersonaNombre persona{esEstudiante, id};
+    porApellido.emplace(std::string(apellidoDe(clave)), persona);
+    porNombre.emplace(std::move(clave), persona);
+}
+
+bool IndiceNombres::quitarDe(std::multimap<std::string, PersonaNombre>& mapa, const std::string& clave,
+                             bool esEstudiante, int id) {
+    auto rango = mapa.equal_range(clave);
+    for (auto it = rango.first; it != rango.second; ++it) {
+        if (it->second.esEstudiante == esEstudiante && it->second.id == id) {
+            mapa.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool IndiceNombres::quitar(std::string_view nombre, bool esEstudiante, int id) {
+    std::string clave = normalizar(nombre);
+    quitarDe(porApellido, std::string(apellidoDe(clave)), esEstudiante, id);
+    return quitarDe(porNombre, clave, esEstudiante, id);
+}
+
+/**
+ * @brief Ubica el primer nombre candidato con lower_bound y avanza mientras siga coincidiendo.
+ */
+std::vector<PersonaNombre> IndiceNombres::buscar(std::string_view texto, BusquedaNombre modo) const {
+    std::vector<PersonaNombre> encontrados;
+    std::string clave = normalizar(texto);
+    const auto& mapa = modo == BusquedaNombre::Apellido ? porApellido : porNombre;
+
+    for (auto it = mapa.lower_bound(clave); it != mapa.end(); ++it) {
+        const std::string& nombre = it->first;
+        bool coincide = modo == BusquedaNombre::Prefijo ? nombre.compare(0, clave.size(), clave) == 0
+                                                        : nombre == clave;
+        if (!coincide) break;
+        encontrados.push_back(it->second);
+    }
+    return encontrados;
+}
+
+void IndiceNombres::limpiar() {
+    porNombre.clear();
+    porApellido.clear();
+}
+
+size_t IndiceNombres::getCantidad() const {
+    return porNombre.size();
+}
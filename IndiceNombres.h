@@ -0,0 +1,86 @@
+#ifndef INDICE_NOMBRES_H
+#define INDICE_NOMBRES_H
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Persona registrada en el índice de nombres.
+ */
+struct PersonaNombre {
+    bool esEstudiante;  ///< true si es estudiante; false si es instructor
+    int id;
+};
+
+/**
+ * @brief Forma de comparar el texto buscado con los nombres.
+ */
+enum class BusquedaNombre {
+    Exacta,     ///< Nombre completo igual al texto
+    Prefijo,    ///< Nombre completo que comienza con el texto
+    Apellido    ///< Última palabra del nombre igual al texto
+};
+
+/**
+ * @class IndiceNombres
+ * @brief Diccionario ordenado de nombres de estudiantes e instructores, sin distinguir mayúsculas.
+ *
+ * Guarda cada nombre normalizado (ver normalizar()) dos veces: completo y por apellido
+ * (su última palabra), en diccionarios ordenados que admiten nombres repetidos. Una búsqueda
+ * exacta, por prefijo o por apellido ubica el primer candidato con una búsqueda binaria y
+ * luego recorre solo los k resultados, en O(L log n + k) para un texto de largo L.
+ */
+class IndiceNombres {
+private:
+    std::multimap<std::string, PersonaNombre> porNombre;
+    std::multimap<std::string, PersonaNombre> porApellido;
+
+    /**
+     * @brief Quita de un diccionario la entrada de una persona bajo una clave.
+     */
+    static bool quitarDe(std::multimap<std::string, PersonaNombre>& mapa, const std::string& clave,
+                         bool esEstudiante, int id);
+
+public:
+    /**
+     * @brief Normaliza un nombre para compararlo sin distinguir mayúsculas.
+     *
+     * Pasa a minúsculas las letras ASCII y las mayúsculas acentuadas de Latin-1 codificadas
+     * en UTF-8 (Á, É, Ñ, ...), quita los espacios de los extremos y reduce cada serie de
+     * espacios a uno solo, de modo que "Juan  Diaz" coincide con "Juan Diaz"; el resto de
+     * los bytes se conserva.
+     */
+    static std::string normalizar(std::string_view nombre);
+
+    /**
+     * @brief Registra el nombre de una persona.
+     */
+    void agregar(std::string_view nombre, bool esEstudiante, int id);
+
+    /**
+     * @brief Quita el nombre de una persona.
+     *
+     * @return true si la persona estaba registrada con ese nombre.
+     */
+    bool quitar(std::string_view nombre, bool esEstudiante, int id);
+
+    /**
+     * @brief Busca personas por nombre.
+     *
+     * @param texto Texto buscado; se normaliza igual que los nombres.
+     * @param modo Forma de comparar.
+     * @return Las personas encontradas, ordenadas por nombre normalizado.
+     */
+    std::vector<PersonaNombre> buscar(std::string_view texto, BusquedaNombre modo) const;
+
+    /**
+     * @brief Vacía el índice.
+     */
+    void limpiar();
+
+    size_t getCantidad() const;
+};
+
+#endif // INDICE_NOMBRES_H
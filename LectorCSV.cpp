@@ -0,0 +1,163 @@
+#include "LectorCSV.h"
+#include "Estudiante.h"
+#include "NodoAVL_Estudiantes.h"
+#include <charconv>
+
+/**
+ * @brief Extrae el siguiente campo hasta un separador.
+ *
+ * @param resto Texto pendiente; se avanza más allá del separador.
+ * @param separador Carácter delimitador.
+ * @return El campo encontrado.
+ */
+std::string_view LectorCSV::siguienteCampo(std::string_view& resto, char separador) {
+    size_t pos = resto.find(separador);
+    std::string_view campo = resto.substr(0, pos);
+    resto = (pos == std::string_view::npos) ? std::string_view() : resto.substr(pos + 1);
+    return campo;
+}
+
+/**
+ * @brief Divide un texto en bloques contiguos que terminan en final de línea.
+ *
+ * Parte de cortes equiespaciados y adelanta cada uno hasta el siguiente '\n'.
+ * Si varios cortes caen dentro de la misma línea, se generan menos bloques.
+ *
+ * @param texto Contenido a dividir.
+ * @param partes Número deseado de bloques.
+ * @return Los bloques resultantes, en orden.
+ */
+std::vector<std::string_view> LectorCSV::dividirEnBloques(std::string_view texto, size_t partes) {
+    std::vector<std::string_view> bloques;
+    if (partes < 1) partes = 1;
+    size_t inicio = 0;
+    for (size_t i = 1; i <= partes && inicio < texto.size(); i++) {
+        size_t fin = texto.size();
+        if (i < partes) {
+            size_t corte = texto.size() / partes * i;
+            if (corte < inicio) corte = inicio;
+            size_t salto = texto.find('\n', corte);
+            fin = (salto == std::string_view::npos) ? texto.size() : salto + 1;
+        }
+        bloques.push_back(texto.substr(inicio, fin - inicio));
+        inicio = fin;
+    }
+    return bloques;
+}
+
+/**
+ * @brief Convierte un campo completo a entero con `std::from_chars`.
+ *
+ * @param texto Campo a convertir (se aceptan ceros a la izquierda, como en "0505").
+ * @param valor Recibe el entero convertido.
+ * @return true si todo el campo es un entero válido.
+ */
+bool LectorCSV::parsearEntero(std::string_view texto, int& valor) {
+    if (texto.empty()) return false;
+    const char* fin = texto.data() + texto.size();
+    auto [ptr, ec] = std::from_chars(texto.data(), fin, valor);
+    return ec == std::errc() && ptr == fin;
+}
+
+/**
+ * @brief Convierte un campo completo a número real con `std::from_chars`.
+ *
+ * @param texto Campo a convertir.
+ * @param valor Recibe el número convertido.
+ * @return true si todo el campo es un número válido.
+ */
+bool LectorCSV::parsearReal(std::string_view texto, double& valor) {
+    if (texto.empty()) return false;
+    const char* fin = texto.data() + texto.size();
+    auto [ptr, ec] = std::from_chars(texto.data(), fin, valor);
+    return ec == std::errc() && ptr == fin;
+}
+
+/**
+ * @brief Analiza una fecha "MM/DD/YYYY HH:MM".
+ *
+ * Además del formato, exige una fecha de calendario válida, hora entre 0 y 23
+ * y minuto entre 0 y 59, ya que estos campos se empaquetan en la clave del AVL.
+ *
+ * @return true si la fecha es válida.
+ */
+bool LectorCSV::parsearFecha(std::string_view texto, int& dia, int& mes, int& anio, int& hora, int& minuto) {
+    std::string_view parteFecha = siguienteCampo(texto, ' ');
+    std::string_view parteHora = texto;
+    if (!parsearEntero(siguienteCampo(parteFecha, '/'), mes)) return false;
+    if (!parsearEntero(siguienteCampo(parteFecha, '/'), dia)) return false;
+    if (!parsearEntero(parteFecha, anio)) return false;
+    if (!parsearEntero(siguienteCampo(parteHora, ':'), hora)) return false;
+    if (!parsearEntero(parteHora, minuto)) return false;
+    if (!Estudiante::validarFecha(dia, mes, anio) || anio > 9999) return false;
+    return hora >= 0 && hora <= 23 && minuto >= 0 && minuto <= 59;
+}
+
+/**
+ * @brief Analiza una fila de estudiantes.csv sin copiar sus campos.
+ *
+ * @param linea Fila a analizar.
+ * @param fila Recibe los campos como vistas sobre `linea`.
+ * @param error Recibe la descripción del problema si la fila es inválida.
+ * @return true si la fila es válida.
+ */
+bool LectorCSV::parsearEstudiante(std::string_view linea, FilaEstudianteCSV& fila, const char*& error) {
+    std::string_view resto = linea;
+    if (!parsearEntero(siguienteCampo(resto, ','), fila.id) ||
+        fila.id < 0 || (uint64_t)fila.id > NodoAVL_Estudiantes::MASCARA_ID) {
+        error = "ID invalido";
+        return false;
+    }
+    fila.nombre = siguienteCampo(resto, ',');
+    if (fila.nombre.empty()) {
+        error = "nombre vacio";
+        return false;
+    }
+    if (resto.empty() ||
+        !parsearFecha(siguienteCampo(resto, ','), fila.dia, fila.mes, fila.anio, fila.hora, fila.minuto)) {
+        error = "fecha invalida (se espera MM/DD/YYYY HH:MM)";
+        return false;
+    }
+    fila.numPreferencias = 0;
+    while (!resto.empty() && fila.numPreferencias < 3) {
+        std::string_view pref = siguienteCampo(resto, '|');
+        if (pref.empty()) continue;
+        if (!estiloDesdeTexto(pref, fila.preferencias[fila.numPreferencias])) {
+            error = "preferencia de baile desconocida";
+            return false;
+        }
+        fila.numPreferencias++;
+    }
+    return true;
+}
+
+/**
+ * @brief Analiza una fila de instructores.csv sin copiar sus campos.
+ *
+ * @param linea Fila a analizar.
+ * @param fila Recibe los campos como vistas sobre `linea`.
+ * @param error Recibe la descripción del problema si la fila es inválida.
+ * @return true si la fila es válida.
+ */
+bool LectorCSV::parsearInstructor(std::string_view linea, FilaInstructorCSV& fila, const char*& error) {
+    std::string_view resto = linea;
+    if (!parsearEntero(siguienteCampo(resto, ','), fila.id)) {
+        error = "ID invalido";
+        return false;
+    }
+    fila.nombre = siguienteCampo(resto, ',');
+    if (fila.nombre.empty()) {
+        error = "nombre vacio";
+        return false;
+    }
+    if (!parsearEntero(siguienteCampo(resto, ','), fila.anioIngreso)) {
+        error = "anio de ingreso invalido";
+        return false;
+    }
+    if (!parsearReal(siguienteCampo(resto, ','), fila.sueldoBase)) {
+        error = "sueldo base invalido";
+        return false;
+    }
+    fila.tipoBaile = resto;
+    return true;
+}
@@ -0,0 +1,133 @@
+#ifndef LECTOR_CSV_H
+#define LECTOR_CSV_H
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+#include "EstiloBaile.h"
+
+/**
+ * @brief Campos de una fila de estudiantes.csv; el nombre es una vista sobre el texto original
+ *        y las preferencias quedan ya codificadas como estilos.
+ *
+ * Formato: ID,Nombre,MM/DD/YYYY HH:MM,Pref1|Pref2|Pref3
+ */
+struct FilaEstudianteCSV {
+    int id;
+    std::string_view nombre;
+    int dia, mes, anio, hora, minuto;
+    EstiloBaile preferencias[3];
+    int numPreferencias;
+};
+
+/**
+ * @brief Campos de una fila de instructores.csv, como vistas sobre el texto original.
+ *
+ * Formato: ID,Nombre,AnioIngreso,SueldoBase,TipoBaile
+ */
+struct FilaInstructorCSV {
+    int id;
+    std::string_view nombre;
+    int anioIngreso;
+    double sueldoBase;
+    std::string_view tipoBaile;
+};
+
+/**
+ * @class LectorCSV
+ * @brief Analizador de filas CSV sin copias, basado en `std::string_view` y `std::from_chars`.
+ *
+ * Los campos se reconocen directamente sobre el texto (por ejemplo, un archivo proyectado
+ * en memoria), sin flujos ni cadenas temporales. Una fila mal formada no lanza excepciones:
+ * el análisis devuelve false junto con una descripción breve del problema, para que el
+ * llamador pueda informarla con su número de línea.
+ */
+class LectorCSV {
+public:
+    /**
+     * @brief Recorre las líneas de un texto, invocando una función por cada línea no vacía.
+     *
+     * Se aceptan finales de línea `\n` y `\r\n`. La numeración de líneas comienza en 1
+     * y cuenta también las líneas vacías, para que coincida con la del archivo.
+     *
+     * @param texto Contenido completo a recorrer.
+     * @param procesar Función invocada como `procesar(std::string_view linea, size_t numeroLinea)`.
+     */
+    template <typename Funcion>
+    static void recorrerLineas(std::string_view texto, Funcion&& procesar) {
+        size_t numeroLinea = 0;
+        size_t inicio = 0;
+        while (inicio < texto.size()) {
+            size_t fin = texto.find('\n', inicio);
+            if (fin == std::string_view::npos) fin = texto.size();
+            std::string_view linea = texto.substr(inicio, fin - inicio);
+            if (!linea.empty() && linea.back() == '\r') linea.remove_suffix(1);
+            numeroLinea++;
+            if (!linea.empty()) procesar(linea, numeroLinea);
+            inicio = fin + 1;
+        }
+    }
+
+    /**
+     * @brief Divide un texto en a lo sumo `partes` bloques contiguos, cortando solo en finales de línea.
+     *
+     * Cada bloque, salvo quizá el último, termina justo después de un '\n', de modo que
+     * ninguna línea queda repartida entre dos bloques y estos pueden analizarse en paralelo.
+     *
+     * @param texto Contenido completo.
+     * @param partes Número deseado de bloques (mínimo 1).
+     * @return Bloques en el orden del texto original; su concatenación es `texto`.
+     */
+    static std::vector<std::string_view> dividirEnBloques(std::string_view texto, size_t partes);
+
+    /**
+     * @brief Analiza una fila de estudiantes.csv.
+     *
+     * Valida el ID, el formato y rango de la fecha y hora, y separa hasta 3 preferencias
+     * delimitadas por '|', que se convierten a EstiloBaile (un nombre desconocido invalida la fila).
+     *
+     * @param linea Texto de la fila, sin el final de línea.
+     * @param fila Estructura donde se dejan los campos reconocidos.
+     * @param error Si la fila es inválida, recibe una descripción del problema.
+     * @return true si la fila es válida; false en caso contrario.
+     */
+    static bool parsearEstudiante(std::string_view linea, FilaEstudianteCSV& fila, const char*& error);
+
+    /**
+     * @brief Analiza una fila de instructores.csv.
+     *
+     * @param linea Texto de la fila, sin el final de línea.
+     * @param fila Estructura donde se dejan los campos reconocidos.
+     * @param error Si la fila es inválida, recibe una descripción del problema.
+     * @return true si la fila es válida; false en caso contrario.
+     */
+    static bool parsearInstructor(std::string_view linea, FilaInstructorCSV& fila, const char*& error);
+
+    /**
+     * @brief Analiza una fecha con formato "MM/DD/YYYY HH:MM" y valida sus rangos.
+     *
+     * @return true si la fecha es válida; false en caso contrario.
+     */
+    static bool parsearFecha(std::string_view texto, int& dia, int& mes, int& anio, int& hora, int& minuto);
+
+    /**
+     * @brief Convierte un texto completo en entero; falla si sobran caracteres.
+     */
+    static bool parsearEntero(std::string_view texto, int& valor);
+
+    /**
+     * @brief Convierte un texto completo en número real; falla si sobran caracteres.
+     */
+    static bool parsearReal(std::string_view texto, double& valor);
+
+    /**
+     * @brief Extrae el siguiente campo hasta un separador y avanza el resto del texto.
+     *
+     * @param resto Texto pendiente; al volver queda después del separador consumido.
+     * @param separador Carácter que termina el campo.
+     * @return El campo extraído (todo el resto si no hay más separadores).
+     */
+    static std::string_view siguienteCampo(std::string_view& resto, char separador);
+};
+
+#endif // LECTOR_CSV_H
@@ -0,0 +1,189 @@
+#include "MotorPagos.h"
+#include "EscritorAtomico.h"
+
+namespace {
+
+/**
+ * @brief Código del estilo cuyo nombre coincide exactamente con el tipo de baile.
+ *
+ * La comparación es exacta, como en Instructor::enseniaTango y en la comparación con el
+ * tipo más popular, para que el bloque aplique los bonos a los mismos instructores.
+ */
+uint8_t codigoExacto(const std::string& tipoBaile, uint8_t desconocido) {
+    for (int i = 0; i < NUM_ESTILOS_BAILE; i++) {
+        if (tipoBaile == nombreEstilo((EstiloBaile)i)) return (uint8_t)i;
+    }
+    return desconocido;
+}
+
+/**
+ * @brief Escribe un texto como cadena JSON, con comillas y caracteres de escape.
+ */
+void escribirCadenaJSON(EscritorAtomico& salida, std::string_view texto) {
+    static const char HEX[] = "0123456789abcdef";
+    salida.escribir('"');
+    for (char c : texto) {
+        switch (c) {
+            case '"': salida.escribir("\\\""); break;
+            case '\\': salida.escribir("\\\\"); break;
+            case '\n': salida.escribir("\\n"); break;
+            case '\r': salida.escribir("\\r"); break;
+            case '\t': salida.escribir("\\t"); break;
+            default:
+                if ((unsigned char)c < 0x20) {
+                    salida.escribir("\\u00");
+                    salida.escribir(HEX[(unsigned char)c >> 4]);
+                    salida.escribir(HEX[(unsigned char)c & 0xF]);
+                } else {
+                    salida.escribir(c);
+                }
+        }
+    }
+    salida.escribir('"');
+}
+
+}
+
+/**
+ * @brief Recorre el ABB en orden, con una pila explícita, y llena los arreglos por campo.
+ *
+ * @param raiz Raíz del ABB de instructores.
+ */
+void MotorPagos::cargar(const NodoABB_Instructores* raiz) {
+    instructores.clear();
+    sueldosBase.clear();
+    aniosIngreso.clear();
+    estilos.clear();
+
+    std::vector<const NodoABB_Instructores*> pila;
+    const NodoABB_Instructores* actual = raiz;
+    while (actual || !pila.empty()) {
+        while (actual) {
+            pila.push_back(actual);
+            actual = actual->izquierdo;
+        }
+        actual = pila.back();
+        pila.pop_back();
+        const Instructor* instr = actual->instructor;
+        instructores.push_back(instr);
+        sueldosBase.push_back(instr->getSueldoBase());
+        aniosIngreso.push_back(instr->getAnioIngreso());
+        estilos.push_back(codigoExacto(instr->getTipoBaile(), ESTILO_DESCONOCIDO));
+        actual = actual->derecho;
+    }
+}
+
+/**
+ * @brief Ciclo de cálculo sin saltos sobre los arreglos contiguos.
+ *
+ * El orden de las sumas es el mismo de Instructor::calcularSueldoBruto (antigüedad,
+ * popularidad, Tango), por lo que el redondeo también coincide. Los bonos que no
+ * corresponden se suman como 0.0, que no altera el resultado.
+ *
+ * @param anioActual Año actual.
+ * @param estiloPopular Estilo con bono de popularidad.
+ */
+void MotorPagos::calcular(int anioActual, EstiloBaile estiloPopular) {
+    const size_t n = sueldosBase.size();
+    brutos.resize(n);
+    cotizacionesAFP.resize(n);
+    liquidos.resize(n);
+
+    const double* base = sueldosBase.data();
+    const int32_t* ingreso = aniosIngreso.data();
+    const uint8_t* estilo = estilos.data();
+    double* bruto = brutos.data();
+    double* afp = cotizacionesAFP.data();
+    double* liquido = liquidos.data();
+    const uint8_t popular = (uint8_t)estiloPopular;
+    const uint8_t tango = (uint8_t)EstiloBaile::Tango;
+
+    for (size_t i = 0; i < n; i++) {
+        // Cada condición vale 0.0 o 1.0; multiplicar una constante por ella es exacto
+        const double antiguedad = (double)(anioActual - ingreso[i] > 5);
+        const double esPopular = (double)(estilo[i] == popular);
+        const double esTango = (double)(estilo[i] == tango);
+
+        // Mismas operaciones y en el mismo orden que Instructor::calcularSueldoBruto
+        double b = base[i];
+        b += Instructor::BONO_ANTIGUEDAD * antiguedad;
+        b += base[i] * (Instructor::PORCENTAJE_POPULARIDAD * esPopular);
+        b += Instructor::BONO_TANGO * esTango;
+        const double a = b * Instructor::PORCENTAJE_AFP;
+        bruto[i] = b;
+        afp[i] = a;
+        liquido[i] = b - a;
+    }
+}
+
+size_t MotorPagos::getCantidad() const {
+    return instructores.size();
+}
+
+const Instructor* MotorPagos::getInstructor(size_t i) const {
+    return instructores[i];
+}
+
+double MotorPagos::getSueldoBruto(size_t i) const {
+    return brutos[i];
+}
+
+double MotorPagos::getCotizacionAFP(size_t i) const {
+    return cotizacionesAFP[i];
+}
+
+double MotorPagos::getSueldoLiquido(size_t i) const {
+    return liquidos[i];
+}
+
+/**
+ * @brief Vuelca los resultados calculados en CSV o JSON por líneas.
+ *
+ * @param ruta Archivo de destino.
+ * @param formato Formato del informe.
+ * @param error Causa de la falla, si la hubo.
+ * @return true si el informe se escribió.
+ */
+bool MotorPagos::exportar(const std::string& ruta, FormatoPagos formato, std::string& error) const {
+    EscritorAtomico salida;
+    if (!salida.abrir(ruta)) {
+        error = "no se pudo abrir " + ruta + " para escritura";
+        return false;
+    }
+
+    if (formato == FormatoPagos::CSV) {
+        salida.escribir("id,nombre,tipoBaile,sueldoBruto,afp,sueldoLiquido\n");
+    }
+    for (size_t i = 0; i < instructores.size(); i++) {
+        const Instructor* instr = instructores[i];
+        if (formato == FormatoPagos::CSV) {
+            salida.escribirEntero(instr->getId());
+            salida.escribir(',');
+            salida.escribir(instr->getNombreCompleto());
+            salida.escribir(',');
+            salida.escribir(instr->getTipoBaile());
+            salida.escribir(',');
+            salida.escribirReal(brutos[i]);
+            salida.escribir(',');
+            salida.escribirReal(cotizacionesAFP[i]);
+            salida.escribir(',');
+            salida.escribirReal(liquidos[i]);
+            salida.escribir('\n');
+        } else {
+            salida.escribir("{\"id\":");
+            salida.escribirEntero(instr->getId());
+            salida.escribir(",\"nombre\":");
+            escribirCadenaJSON(salida, instr->getNombreCompleto());
+            salida.escribir(",\"tipoBaile\":");
+            escribirCadenaJSON(salida, instr->getTipoBaile());
+            salida.escribir(",\"sueldoBruto\":");
+            salida.escribirReal(brutos[i]);
+            salida.escribir(",\"afp\":");
+            salida.escribirReal(cotizacionesAFP[i]);
+            salida.escribir(",\"sueldoLiquido\":");
+            salida.escribirReal(liquidos[i]);
+            salida.escribir("}\n");
+        }
+    }
+    return salida.confirmar(error);
+}
@@ -0,0 +1,87 @@
+#ifndef MOTOR_PAGOS_H
+#define MOTOR_PAGOS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "EstiloBaile.h"
+#include "NodoABB_Instructores.h"
+
+/**
+ * @brief Formatos del informe de pagos.
+ */
+enum class FormatoPagos {
+    CSV,        ///< Una fila por instructor, con encabezado
+    JSONL       ///< Un objeto JSON por línea
+};
+
+/**
+ * @class MotorPagos
+ * @brief Cálculo de remuneraciones de todos los instructores en bloque.
+ *
+ * Los datos que intervienen en el sueldo (sueldo base, año de ingreso y estilo) se copian
+ * una vez a arreglos contiguos, uno por campo. El cálculo recorre esos arreglos en un solo
+ * ciclo sin saltos: cada bono se suma multiplicado por su condición (0 o 1), lo que permite
+ * al compilador vectorizarlo. Como sumar 0.0 no altera un double, los resultados son
+ * idénticos a los de Instructor::calcularSueldoBruto, calcularCotizacionAFP y
+ * calcularSueldoLiquido (el proyecto se compila sin fusión de multiplicación y suma,
+ * ver CMakeLists.txt, para que ambos caminos redondeen igual).
+ */
+class MotorPagos {
+private:
+    /// Código de estilo para instructores cuyo tipo de baile no es un EstiloBaile exacto
+    static const uint8_t ESTILO_DESCONOCIDO = 0xFF;
+
+    std::vector<const Instructor*> instructores;    ///< Instructores en orden de ID
+    std::vector<double> sueldosBase;
+    std::vector<int32_t> aniosIngreso;
+    std::vector<uint8_t> estilos;                   ///< Código de EstiloBaile o ESTILO_DESCONOCIDO
+
+    std::vector<double> brutos;
+    std::vector<double> cotizacionesAFP;
+    std::vector<double> liquidos;
+
+public:
+    /**
+     * @brief Copia a los arreglos los datos de todos los instructores del árbol, en orden de ID.
+     *
+     * @param raiz Raíz del ABB de instructores.
+     */
+    void cargar(const NodoABB_Instructores* raiz);
+
+    /**
+     * @brief Calcula bruto, AFP y líquido de todos los instructores cargados.
+     *
+     * @param anioActual Año usado para la antigüedad.
+     * @param estiloPopular Estilo que recibe el bono de popularidad.
+     */
+    void calcular(int anioActual, EstiloBaile estiloPopular);
+
+    /**
+     * @brief Cantidad de instructores cargados.
+     */
+    size_t getCantidad() const;
+
+    const Instructor* getInstructor(size_t i) const;
+    double getSueldoBruto(size_t i) const;
+    double getCotizacionAFP(size_t i) const;
+    double getSueldoLiquido(size_t i) const;
+
+    /**
+     * @brief Escribe el resultado del último cálculo en un archivo.
+     *
+     * Las filas se formatean en el búfer de EscritorAtomico y se vuelcan por bloques; el
+     * archivo aparece completo o no aparece.
+     *
+     * Columnas: id, nombre, tipoBaile, sueldoBruto, afp, sueldoLiquido.
+     *
+     * @param ruta Archivo de destino.
+     * @param formato CSV o JSON por líneas.
+     * @param error Recibe la causa si la escritura falla.
+     * @return true si el informe quedó escrito.
+     */
+    bool exportar(const std::string& ruta, FormatoPagos formato, std::string& error) const;
+};
+
+#endif // MOTOR_PAGOS_H
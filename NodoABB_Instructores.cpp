@@ -5,7 +5,7 @@
  * @brief Construye un nuevo nodo para el Árbol Binario de Búsqueda (ABB) de instructores.
  *
  * Inicializa un nodo del ABB asociando un objeto Instructor proporcionado, con sus punteros
- * a hijos izquierdo y derecho establecidos en nullptr.
+ * a hijos izquierdo y derecho establecidos en nullptr y altura 1.
  *
  * @param inst Puntero al objeto Instructor que será almacenado en el nodo. Este parámetro
  *             contiene los datos específicos del instructor que estarán vinculados al nodo.
@@ -14,7 +14,8 @@
 NodoABB_Instructores::NodoABB_Instructores(Instructor* inst)
     : instructor(inst),
       izquierdo(nullptr),
-      derecho(nullptr)
+      derecho(nullptr),
+      altura(1)
 {
 
 }
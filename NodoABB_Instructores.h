@@ -9,7 +9,9 @@
  * @brief Representa un nodo en un Árbol Binario de Búsqueda (ABB) para instructores.
  *
  * Esta clase encapsula la estructura de un nodo en un ABB, que incluye un puntero
- * a un objeto `Instructor` y punteros a los nodos hijos izquierdo y derecho.
+ * a un objeto `Instructor`, punteros a los nodos hijos izquierdo y derecho y la altura
+ * del subárbol, usada para mantener el árbol balanceado (criterio AVL) sin importar
+ * el orden en que se inserten los instructores.
  * Proporciona un constructor para inicializar el nodo con un instructor y un destructor
  * para liberar los recursos asociados.
  */
@@ -44,11 +46,21 @@ public:
     */
     NodoABB_Instructores* derecho;
 
+    /**
+    * @variable altura
+    * @brief Altura del subárbol cuya raíz es este nodo (una hoja tiene altura 1).
+    *
+    * Permite calcular el factor de equilibrio y aplicar rotaciones al insertar o eliminar,
+    * garantizando una altura O(log n) aunque los instructores se carguen ordenados por ID.
+    */
+    int altura;
+
     /**
     * @brief Construye un nuevo objeto NodoABB_Instructores con el instructor proporcionado.
     *
     * Inicializa un nodo en el Árbol Binario de Búsqueda (ABB) para instructores, asociando
-    * el objeto instructor especificado con el nodo y estableciendo sus nodos hijos en nulo.
+    * el objeto instructor especificado con el nodo, estableciendo sus nodos hijos en nulo
+    * y su altura en 1.
     *
     * @param inst Puntero a un objeto Instructor que se almacenará en el nodo.
     *             Este parámetro representa los datos del instructor que gestionará el nodo.
@@ -102,6 +114,27 @@ public:
 
 };
 
+// Operaciones sobre el ABB de instructores, definidas en Sistema.cpp
+
+/**
+ * @brief Inserta un instructor en el ABB, reequilibrándolo como un AVL.
+ *
+ * @return La nueva raíz. Si el ID ya existía, el instructor no se enlaza.
+ */
+NodoABB_Instructores* insertarEnABB(NodoABB_Instructores* raiz, Instructor* instr);
 
+/**
+ * @brief Busca un instructor por ID, en O(log n).
+ *
+ * @return El instructor, o nullptr si no está.
+ */
+Instructor* buscarEnABB(NodoABB_Instructores* raiz, int id);
+
+/**
+ * @brief Elimina (y libera) el instructor con el ID dado, reequilibrando el camino.
+ *
+ * @return La nueva raíz.
+ */
+NodoABB_Instructores* eliminarNodoABB(NodoABB_Instructores* raiz, int id);
 
 #endif // NODOABB_INSTRUCTORES_H
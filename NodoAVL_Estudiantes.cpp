@@ -5,8 +5,8 @@
  *
  * Inicializa un nodo AVL con un puntero a un objeto Estudiante.
  * Los punteros izquierdo y derecho se establecen en nullptr, la
- * altura se fija en 1 y la clave de fecha se inicializa con la
- * fecha de matrícula del estudiante.
+ * altura y el tamaño se fijan en 1 y la clave se empaqueta a partir de la
+ * fecha de matrícula y el ID del estudiante.
  *
  * @param est Puntero al objeto Estudiante que representa al estudiante
  * asociado con el nodo.
@@ -17,9 +17,53 @@ NodoAVL_Estudiantes::NodoAVL_Estudiantes(Estudiante* est)
       izquierdo(nullptr),
       derecho(nullptr),
       altura(1),
-      claveFecha(est->getFechaMatricula())
+      tamanio(1),
+      clave(generarClave(est))
 {
 
 }
 
+/**
+ * @brief Empaqueta la fecha de matrícula y el ID en una clave de 64 bits.
+ *
+ * Cada campo se ubica en su propio rango de bits (año 14, mes 4, día 5, hora 5,
+ * minuto 6 e ID 30), por lo que el orden de las claves coincide con el orden
+ * cronológico y el ID actúa como desempate.
+ *
+ * @return La clave empaquetada.
+ */
+uint64_t NodoAVL_Estudiantes::generarClave(int anio, int mes, int dia, int hora, int minuto, int id) {
+    uint64_t fecha = uint64_t(anio & 0x3FFF);
+    fecha = (fecha << 4) | uint64_t(mes & 0xF);
+    fecha = (fecha << 5) | uint64_t(dia & 0x1F);
+    fecha = (fecha << 5) | uint64_t(hora & 0x1F);
+    fecha = (fecha << 6) | uint64_t(minuto & 0x3F);
+    return (fecha << BITS_ID) | (uint64_t(id) & MASCARA_ID);
+}
+
+/**
+ * @brief Calcula la clave empaquetada de un estudiante a partir de sus campos de fecha e ID.
+ *
+ * @param est Estudiante del cual se obtiene la clave.
+ * @return La clave empaquetada del estudiante.
+ */
+uint64_t NodoAVL_Estudiantes::generarClave(const Estudiante* est) {
+    return generarClave(est->getAnio(), est->getMes(), est->getDia(),
+                        est->getHora(), est->getMinuto(), est->getId());
+}
 
+/**
+ * @brief Separa una clave empaquetada en sus campos de fecha e ID.
+ *
+ * @param clave Clave generada con generarClave.
+ */
+void NodoAVL_Estudiantes::desempaquetarClave(uint64_t clave, int& anio, int& mes, int& dia,
+                                             int& hora, int& minuto, int& id) {
+    id = int(clave & MASCARA_ID);
+    uint64_t fecha = clave >> BITS_ID;
+    minuto = int(fecha & 0x3F); fecha >>= 6;
+    hora = int(fecha & 0x1F);   fecha >>= 5;
+    dia = int(fecha & 0x1F);    fecha >>= 5;
+    mes = int(fecha & 0xF);     fecha >>= 4;
+    anio = int(fecha & 0x3FFF);
+}
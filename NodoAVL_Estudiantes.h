@@ -2,6 +2,7 @@
 #define NODOAVL_ESTUDIANTES_H
 
 #include <string>
+#include <cstdint>
 #include "Estudiante.h"
 
 /**
@@ -11,8 +12,9 @@
  *
  * Esta clase implementa un nodo en un árbol AVL que almacena un puntero a un objeto
  * Estudiante. También contiene punteros a sus hijos izquierdo y derecho, así como
- * un atributo para registrar la altura del nodo y una clave derivada de la fecha
- * de matrícula utilizada para ordenar los nodos dentro del árbol.
+ * atributos para registrar la altura y el tamaño del subárbol, y una clave entera empaquetada,
+ * derivada de la fecha de matrícula y del ID, utilizada para ordenar los nodos
+ * dentro del árbol.
  */
 class NodoAVL_Estudiantes {
 public:
@@ -20,21 +22,71 @@ public:
     NodoAVL_Estudiantes* izquierdo;
     NodoAVL_Estudiantes* derecho;
     int altura;                 // Altura del nodo en el AVL
-    std::string claveFecha;     // Repetir fechaMatricula para orden (MM/DD/YYYY HH:MM)
+    int tamanio;                // Cantidad de nodos del subarbol con raiz en este nodo
+    uint64_t clave;             // Fecha de matricula + ID empaquetados (ver generarClave)
+
+    // Distribucion de bits de la clave, de mas a menos significativo:
+    // anio (14) | mes (4) | dia (5) | hora (5) | minuto (6) | id (30)
+    static const int BITS_ID = 30;
+    static const uint64_t MASCARA_ID = (uint64_t(1) << BITS_ID) - 1;
 
     /**
      * @brief Constructor de la clase NodoAVL_Estudiantes.
      *
      * Inicializa un nodo AVL con un puntero a un objeto Estudiante.
      * Los punteros a los hijos izquierdo y derecho se establecen en nullptr,
-     * la altura se inicializa en 1, y la clave de fecha se establece
-     * a partir de la fecha de matrícula del estudiante.
+     * la altura y el tamaño se inicializan en 1, y la clave se calcula a partir de la
+     * fecha de matrícula y el ID del estudiante.
      *
      * @param est Puntero al objeto Estudiante que se almacenará en el nodo.
      */
     NodoAVL_Estudiantes(Estudiante* est);
 
+    /**
+     * @brief Empaqueta una fecha de matrícula y un ID en una clave de 64 bits.
+     *
+     * Los campos se ubican de más a menos significativo (año, mes, día, hora,
+     * minuto, ID), de modo que comparar dos claves como enteros equivale a
+     * comparar cronológicamente las fechas y, ante la misma fecha, los IDs.
+     * Así dos estudiantes matriculados en el mismo minuto quedan como entradas distintas.
+     *
+     * @return La clave empaquetada.
+     */
+    static uint64_t generarClave(int anio, int mes, int dia, int hora, int minuto, int id);
 
+    /**
+     * @brief Calcula la clave empaquetada de un estudiante.
+     *
+     * @param est Estudiante del cual se toman la fecha de matrícula y el ID.
+     * @return La clave empaquetada del estudiante.
+     */
+    static uint64_t generarClave(const Estudiante* est);
+
+    /**
+     * @brief Recupera la fecha de matrícula y el ID a partir de una clave empaquetada.
+     *
+     * Operación inversa de generarClave.
+     */
+    static void desempaquetarClave(uint64_t clave, int& anio, int& mes, int& dia,
+                                   int& hora, int& minuto, int& id);
 };
 
+// Operaciones sobre el AVL de estudiantes, definidas en Sistema.cpp
+
+/**
+ * @brief Inserta un nodo en el AVL, ordenado por su clave empaquetada.
+ *
+ * @param insertado Queda en false si la clave ya existía; en ese caso el nodo no se enlaza.
+ * @return La nueva raíz.
+ */
+NodoAVL_Estudiantes* insertarEnAVL(NodoAVL_Estudiantes* nodo, NodoAVL_Estudiantes* nuevo, bool& insertado);
+
+/**
+ * @brief Desenlaza del AVL el nodo con la clave dada, sin liberarlo.
+ *
+ * @param eliminado Recibe el nodo desenlazado, o nullptr si la clave no estaba.
+ * @return La nueva raíz.
+ */
+NodoAVL_Estudiantes* eliminarDeAVL(NodoAVL_Estudiantes* nodo, uint64_t clave, NodoAVL_Estudiantes*& eliminado);
+
 #endif // NODOAVL_ESTUDIANTES_H
@@ -0,0 +1,129 @@
+#include "PoolEstudiantes.h"
+
+/**
+ * @brief Constructor del pool de estudiantes.
+ *
+ * No reserva memoria hasta la primera asignación o reserva.
+ */
+PoolEstudiantes::PoolEstudiantes()
+    : libres(nullptr),
+      enUso(0)
+{
+}
+
+/**
+ * @brief Destructor del pool de estudiantes.
+ *
+ * Delega en liberarTodo() la destrucción de los estudiantes vivos y la liberación de los bloques.
+ */
+PoolEstudiantes::~PoolEstudiantes() {
+    liberarTodo();
+}
+
+/**
+ * @brief Obtiene una ranura vacía.
+ *
+ * Primero intenta reciclar una ranura de la lista libre; si no hay, toma la siguiente
+ * ranura del bloque activo, reservando un bloque nuevo cuando el activo está lleno.
+ *
+ * @return Ranura lista para construir un estudiante y su nodo.
+ */
+PoolEstudiantes::Ranura* PoolEstudiantes::obtenerRanura() {
+    if (libres) {
+        Ranura* r = libres;
+        libres = r->siguienteLibre;
+        return r;
+    }
+    if (bloques.empty() || bloques.back().usadas == bloques.back().capacidad) {
+        bloques.push_back(Bloque{new Ranura[RANURAS_POR_BLOQUE], RANURAS_POR_BLOQUE, 0});
+    }
+    Bloque& activo = bloques.back();
+    Ranura* r = &activo.ranuras[activo.usadas++];
+    r->enUso = false;
+    return r;
+}
+
+/**
+ * @brief Agrega una ranura vacía a la lista libre.
+ *
+ * @param r Ranura cuyo contenido ya fue destruido (o nunca se construyó).
+ */
+void PoolEstudiantes::devolverRanura(Ranura* r) {
+    r->enUso = false;
+    r->siguienteLibre = libres;
+    libres = r;
+}
+
+/**
+ * @brief Libera el estudiante y el nodo de una ranura, reciclándola.
+ *
+ * El nodo es el primer miembro de la ranura, por lo que su dirección coincide con la de la ranura.
+ *
+ * @param nodo Nodo creado por este pool.
+ */
+void PoolEstudiantes::liberar(NodoAVL_Estudiantes* nodo) {
+    if (!nodo) return;
+    Ranura* r = reinterpret_cast<Ranura*>(nodo);
+    nodo->estudiante->~Estudiante();
+    nodo->~NodoAVL_Estudiantes();
+    devolverRanura(r);
+    enUso--;
+}
+
+/**
+ * @brief Destruye los estudiantes vivos y libera todos los bloques.
+ *
+ * Recorre cada bloque de forma secuencial (memoria contigua) llamando a los destructores
+ * de las ranuras ocupadas, y luego devuelve cada bloque completo al sistema.
+ */
+void PoolEstudiantes::liberarTodo() {
+    for (Bloque& b : bloques) {
+        for (size_t i = 0; i < b.usadas; i++) {
+            Ranura& r = b.ranuras[i];
+            if (!r.enUso) continue;
+            NodoAVL_Estudiantes* nodo = reinterpret_cast<NodoAVL_Estudiantes*>(r.datosNodo);
+            nodo->estudiante->~Estudiante();
+            nodo->~NodoAVL_Estudiantes();
+        }
+        delete[] b.ranuras;
+    }
+    bloques.clear();
+    libres = nullptr;
+    enUso = 0;
+}
+
+/**
+ * @brief Reserva un bloque contiguo para al menos n estudiantes nuevos.
+ *
+ * Si la lista libre y el bloque activo ya alcanzan, no hace nada. En caso contrario las
+ * ranuras sin usar del bloque activo pasan a la lista libre, ya que solo se toman ranuras
+ * del último bloque, y el nuevo bloque pasa a ser el activo, dimensionado para cubrir lo
+ * que falta.
+ *
+ * @param n Número de estudiantes que se van a crear.
+ */
+void PoolEstudiantes::reservar(size_t n) {
+    size_t recicladas = 0;
+    for (Ranura* r = libres; r && recicladas < n; r = r->siguienteLibre) recicladas++;
+    size_t restantesActivo = bloques.empty() ? 0 : bloques.back().capacidad - bloques.back().usadas;
+    if (recicladas + restantesActivo >= n) return;
+
+    if (restantesActivo > 0) {
+        // En orden inverso, para que la lista libre las entregue en orden de memoria
+        Bloque& activo = bloques.back();
+        for (size_t i = activo.capacidad; i > activo.usadas; i--) devolverRanura(&activo.ranuras[i - 1]);
+        activo.usadas = activo.capacidad;
+    }
+    size_t capacidad = n - recicladas - restantesActivo;
+    if (capacidad < RANURAS_POR_BLOQUE) capacidad = RANURAS_POR_BLOQUE;
+    bloques.push_back(Bloque{new Ranura[capacidad], capacidad, 0});
+}
+
+/**
+ * @brief Obtiene el número de estudiantes vivos en el pool.
+ *
+ * @return Cantidad de ranuras ocupadas.
+ */
+size_t PoolEstudiantes::getEnUso() const {
+    return enUso;
+}
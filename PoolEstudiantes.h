@@ -0,0 +1,127 @@
+#ifndef POOL_ESTUDIANTES_H
+#define POOL_ESTUDIANTES_H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+#include "Estudiante.h"
+#include "NodoAVL_Estudiantes.h"
+
+/**
+ * @class PoolEstudiantes
+ * @brief Asignador por bloques (slab) para los registros de estudiantes y sus nodos AVL.
+ *
+ * Cada estudiante ocupa una única ranura que contiene, una junto a la otra, la memoria de
+ * su NodoAVL_Estudiantes y la de su Estudiante. Las ranuras se reservan en bloques
+ * contiguos, de modo que una carga masiva hace pocas llamadas al asignador del sistema y
+ * los recorridos del árbol tocan memoria cercana. Las ranuras liberadas se reciclan
+ * mediante una lista libre, y al destruir el pool todos los bloques se liberan de una vez.
+ */
+class PoolEstudiantes {
+private:
+    /**
+     * @brief Ranura con la memoria de un nodo y de su estudiante.
+     *
+     * El nodo va primero para poder recuperar la ranura a partir del puntero al nodo.
+     */
+    struct Ranura {
+        alignas(NodoAVL_Estudiantes) unsigned char datosNodo[sizeof(NodoAVL_Estudiantes)];
+        alignas(Estudiante) unsigned char datosEstudiante[sizeof(Estudiante)];
+        Ranura* siguienteLibre;     ///< Siguiente ranura en la lista libre
+        bool enUso;                 ///< true si la ranura contiene objetos construidos
+    };
+
+    /**
+     * @brief Bloque contiguo de ranuras, ocupado de forma secuencial.
+     */
+    struct Bloque {
+        Ranura* ranuras;
+        size_t capacidad;
+        size_t usadas;
+    };
+
+    std::vector<Bloque> bloques;    ///< Bloques reservados; el último es el activo
+    Ranura* libres;                 ///< Lista de ranuras recicladas
+    size_t enUso;                   ///< Número de estudiantes vivos en el pool
+
+    /**
+     * @brief Obtiene una ranura vacía, reciclando una liberada o tomando la siguiente del bloque activo.
+     */
+    Ranura* obtenerRanura();
+
+    /**
+     * @brief Devuelve una ranura a la lista libre sin destruir su contenido.
+     */
+    void devolverRanura(Ranura* r);
+
+public:
+    /// Número de ranuras de cada bloque cuando no se ha pedido una reserva explícita.
+    static const size_t RANURAS_POR_BLOQUE = 1024;
+
+    /**
+     * @brief Construye un pool vacío; el primer bloque se reserva con la primera asignación.
+     */
+    PoolEstudiantes();
+
+    /**
+     * @brief Destruye todos los estudiantes vivos y libera los bloques en una sola pasada.
+     */
+    ~PoolEstudiantes();
+
+    PoolEstudiantes(const PoolEstudiantes&) = delete;
+    PoolEstudiantes& operator=(const PoolEstudiantes&) = delete;
+
+    /**
+     * @brief Construye un estudiante y su nodo AVL en una misma ranura.
+     *
+     * Los argumentos se reenvían a un constructor de Estudiante. El nodo devuelto
+     * apunta al estudiante recién construido y aún no está enlazado a ningún árbol.
+     *
+     * @return Puntero al nodo creado.
+     */
+    template <typename... Args>
+    NodoAVL_Estudiantes* crear(Args&&... args) {
+        Ranura* r = obtenerRanura();
+        Estudiante* est;
+        try {
+            est = new (r->datosEstudiante) Estudiante(std::forward<Args>(args)...);
+        } catch (...) {
+            devolverRanura(r);
+            throw;
+        }
+        NodoAVL_Estudiantes* nodo = new (r->datosNodo) NodoAVL_Estudiantes(est);
+        r->enUso = true;
+        enUso++;
+        return nodo;
+    }
+
+    /**
+     * @brief Destruye el estudiante y el nodo de una ranura y la deja disponible para reutilizarse.
+     *
+     * @param nodo Nodo obtenido con crear(); no debe seguir enlazado a ningún árbol.
+     */
+    void liberar(NodoAVL_Estudiantes* nodo);
+
+    /**
+     * @brief Destruye todos los estudiantes vivos y libera todos los bloques.
+     */
+    void liberarTodo();
+
+    /**
+     * @brief Asegura que haya al menos n ranuras disponibles sin reservar más bloques al crearlas.
+     *
+     * Útil antes de una carga masiva cuyo tamaño se conoce o se puede estimar. Las ranuras
+     * sueltas del bloque activo se reutilizan y el resto queda en un único bloque contiguo.
+     *
+     * @param n Número de estudiantes que se van a crear.
+     */
+    void reservar(size_t n);
+
+    /**
+     * @brief Obtiene el número de estudiantes vivos en el pool.
+     */
+    size_t getEnUso() const;
+};
+
+#endif // POOL_ESTUDIANTES_H
@@ -0,0 +1,420 @@
+#include "ProcesadorLotes.h"
+#include "Sistema.h"
+#include "SistemaConcurrente.h"
+#include "LectorCSV.h"
+#include "MotorPagos.h"
+#include <charconv>
+#include <istream>
+
+namespace {
+
+// Separa el siguiente campo delimitado por coma y lo quita de `resto`
+std::string_view siguienteCampo(std::string_view& resto) {
+    size_t coma = resto.find(',');
+    std::string_view campo = resto.substr(0, coma);
+    resto = coma == std::string_view::npos ? std::string_view() : resto.substr(coma + 1);
+    return campo;
+}
+
+bool leerId(std::string_view texto, int& id) {
+    const char* fin = texto.data() + texto.size();
+    std::from_chars_result r = std::from_chars(texto.data(), fin, id);
+    return r.ec == std::errc() && r.ptr == fin;
+}
+
+bool leerFecha(std::string_view texto, FechaHora& fecha) {
+    return LectorCSV::parsearFecha(texto, fecha.dia, fecha.mes, fecha.anio, fecha.hora, fecha.minuto);
+}
+
+// Convierte "Salsa|Tango" en códigos de estilo; acepta entre 1 y 3 estilos conocidos
+bool leerPreferencias(std::string_view texto, EstiloBaile preferencias[3], int& numPreferencias) {
+    numPreferencias = 0;
+    while (!texto.empty()) {
+        size_t barra = texto.find('|');
+        std::string_view nombre = texto.substr(0, barra);
+        texto = barra == std::string_view::npos ? std::string_view() : texto.substr(barra + 1);
+        if (numPreferencias == 3 || !estiloDesdeTexto(nombre, preferencias[numPreferencias])) return false;
+        numPreferencias++;
+    }
+    return numPreferencias > 0;
+}
+
+} // namespace
+
+ProcesadorLotes::ProcesadorLotes(Sistema& sistema, std::FILE* destino)
+    : sistema(&sistema), concurrente(nullptr), destino(destino), numComandos(0), numErrores(0),
+      siguienteClave(0), claveFinal(0), mascaraListado(0), filasListadas(0) {
+    salida.reserve(CAPACIDAD_BUFFER + 4096);
+}
+
+ProcesadorLotes::ProcesadorLotes(SistemaConcurrente& concurrente)
+    : sistema(nullptr), concurrente(&concurrente), destino(nullptr), numComandos(0), numErrores(0),
+      siguienteClave(0), claveFinal(0), mascaraListado(0), filasListadas(0) {}
+
+ProcesadorLotes::~ProcesadorLotes() {
+    vaciar();
+}
+
+void ProcesadorLotes::escribirEntero(long long valor) {
+    char texto[24];
+    std::to_chars_result r = std::to_chars(texto, texto + sizeof(texto), valor);
+    salida.append(texto, r.ptr - texto);
+}
+
+void ProcesadorLotes::escribirReal(double valor) {
+    char texto[32];
+    std::to_chars_result r = std::to_chars(texto, texto + sizeof(texto), valor, std::chars_format::fixed);
+    if (r.ec != std::errc()) r = std::to_chars(texto, texto + sizeof(texto), valor);
+    salida.append(texto, r.ptr - texto);
+}
+
+/**
+ * @brief Agrega una fila "estudiante,<id>,<nombre>,<MM/DD/YYYY HH:MM>,<prefs>", con el mismo
+ *        formato de estudiantes.csv.
+ *
+ * La fecha es la que el estudiante ya guarda formateada (Estudiante::getFechaMatricula()).
+ */
+void ProcesadorLotes::escribirEstudiante(const Estudiante& est) {
+    salida += "estudiante,";
+    escribirEntero(est.getId());
+    salida += ',';
+    salida += est.getNombre();
+    salida += ',';
+    salida += est.getFechaMatricula();
+    salida += ',';
+    for (int i = 0; i < est.getNumPreferencias(); i++) {
+        if (i > 0) salida += '|';
+        salida += est.getPreferencia(i);
+    }
+    salida += '\n';
+}
+
+/**
+ * @brief Agrega una fila por estudiante del rango y la línea "ok,<cantidad>".
+ */
+void ProcesadorLotes::escribirEstudiantes(const RangoEstudiantes& estudiantes) {
+    size_t filas = 0;
+    for (const Estudiante& est : estudiantes) {
+        escribirEstudiante(est);
+        vaciarSiCorresponde();
+        filas++;
+    }
+    salida += "ok,";
+    escribirEntero((long long)filas);
+    salida += '\n';
+}
+
+/**
+ * @brief Agrega una fila "instructor,<id>,<nombre>,<anioIngreso>,<sueldoBase>,<tipoBaile>".
+ */
+void ProcesadorLotes::escribirInstructor(const Instructor& instr) {
+    salida += "instructor,";
+    escribirEntero(instr.getId());
+    salida += ',';
+    salida += instr.getNombreCompleto();
+    salida += ',';
+    escribirEntero(instr.getAnioIngreso());
+    salida += ',';
+    escribirReal(instr.getSueldoBase());
+    salida += ',';
+    salida += instr.getTipoBaile();
+    salida += '\n';
+}
+
+/**
+ * @brief Agrega una fila "pago,<id>,<nombre>,<tipoBaile>,<bruto>,<cotizacion>,<liquido>".
+ */
+void ProcesadorLotes::escribirPago(int id, const std::string& nombre, const std::string& tipoBaile,
+                                   double bruto, double cotizacion, double liquido) {
+    salida += "pago,";
+    escribirEntero(id);
+    salida += ',';
+    salida += nombre;
+    salida += ',';
+    salida += tipoBaile;
+    salida += ',';
+    escribirReal(bruto);
+    salida += ',';
+    escribirReal(cotizacion);
+    salida += ',';
+    escribirReal(liquido);
+    salida += '\n';
+}
+
+void ProcesadorLotes::iniciarListado(uint64_t claveInicio, uint64_t claveFin, uint8_t mascara) {
+    listado = concurrente->instantaneaEstudiantes();
+    siguienteClave = claveInicio;
+    claveFinal = claveFin;
+    mascaraListado = mascara;
+    filasListadas = 0;
+    continuarListado();
+}
+
+bool ProcesadorLotes::hayListadoPendiente() const {
+    return listado != nullptr;
+}
+
+/**
+ * @brief Escribe hasta FILAS_POR_BLOQUE filas desde la clave siguiente a la última escrita.
+ *
+ * Las claves son únicas, así que el bloque siguiente retoma en la última clave + 1. Todos los
+ * bloques recorren la misma versión, por lo que el listado completo es coherente aunque haya
+ * matrículas entre un bloque y otro.
+ */
+void ProcesadorLotes::continuarListado() {
+    if (!listado) return;
+    size_t filas = 0;
+    bool completo = true;
+    listado->recorrer(
+        [&](const Estudiante& est) {
+            if (filas == FILAS_POR_BLOQUE) {
+                completo = false;
+                return false;
+            }
+            escribirEstudiante(est);
+            siguienteClave = NodoAVL_Estudiantes::generarClave(&est) + 1;
+            filas++;
+            return true;
+        },
+        siguienteClave, claveFinal, mascaraListado);
+    filasListadas += filas;
+    if (completo) {
+        listado.reset();
+        salida += "ok,";
+        escribirEntero((long long)filasListadas);
+        salida += '\n';
+    }
+}
+
+void ProcesadorLotes::escribirError(std::string_view causa) {
+    numErrores++;
+    salida += "error,";
+    salida += causa;
+    salida += '\n';
+}
+
+void ProcesadorLotes::vaciarSiCorresponde() {
+    if (destino && salida.size() >= CAPACIDAD_BUFFER) vaciar();
+}
+
+void ProcesadorLotes::vaciar() {
+    if (!destino) return;
+    if (!salida.empty()) {
+        std::fwrite(salida.data(), 1, salida.size(), destino);
+        salida.clear();
+    }
+    std::fflush(destino);
+}
+
+void ProcesadorLotes::extraerSalida(std::string& respuestas) {
+    respuestas.clear();
+    respuestas.swap(salida);
+}
+
+/**
+ * @brief Reconoce el comando de la línea y lo ejecuta con las operaciones públicas del Sistema,
+ *        o de la fachada concurrente si se construyó con una.
+ *
+ * @param linea Comando y argumentos separados por comas.
+ * @return false si el comando terminó con error.
+ */
+bool ProcesadorLotes::ejecutarComando(std::string_view linea) {
+    if (!linea.empty() && linea.back() == '\r') linea.remove_suffix(1);
+    if (linea.empty() || linea.front() == '#') return true;
+    while (listado) continuarListado();
+    numComandos++;
+    const size_t erroresPrevios = numErrores;
+
+    std::string_view resto = linea;
+    std::string_view comando = siguienteCampo(resto);
+    int id;
+
+    if (comando == "matricular") {
+        std::string_view nombre = siguienteCampo(resto);
+        std::string_view fechaTexto = siguienteCampo(resto);
+        std::string_view prefsTexto = siguienteCampo(resto);
+        FechaHora fecha;
+        EstiloBaile preferencias[3];
+        int numPreferencias;
+        std::string error;
+        if (!resto.empty()) {
+            escribirError("demasiados campos");
+        } else if (!leerFecha(fechaTexto, fecha)) {
+            escribirError("fecha invalida");
+        } else if (!leerPreferencias(prefsTexto, preferencias, numPreferencias)) {
+            escribirError("preferencias invalidas");
+        } else {
+            int existente;
+            if (concurrente) {
+                id = concurrente->matricularEstudiante(std::string(nombre), fecha.dia, fecha.mes, fecha.anio,
+                                                       fecha.hora, fecha.minuto, preferencias, numPreferencias,
+                                                       error, &existente);
+            } else {
+                id = sistema->matricularEstudiante(std::string(nombre), fecha.dia, fecha.mes, fecha.anio,
+                                                   fecha.hora, fecha.minuto, preferencias, numPreferencias,
+                                                   error, &existente);
+            }
+            if (id < 0) {
+                escribirError(error);
+            } else {
+                // Un nombre repetido no impide la matrícula, pero se informa antes del estado
+                if (existente >= 0) {
+                    salida += "aviso,nombre duplicado,";
+                    escribirEntero(existente);
+                    salida += '\n';
+                }
+                salida += "ok,";
+                escribirEntero(id);
+                salida += '\n';
+            }
+        }
+    } else if (comando == "nombre") {
+        std::string_view texto = siguienteCampo(resto);
+        std::string_view modoTexto = siguienteCampo(resto);
+        BusquedaNombre modo = BusquedaNombre::Exacta;
+        bool valido = resto.empty() && !texto.empty();
+        if (modoTexto == "prefijo") modo = BusquedaNombre::Prefijo;
+        else if (modoTexto == "apellido") modo = BusquedaNombre::Apellido;
+        else if (!modoTexto.empty()) valido = false;
+        if (!valido) {
+            escribirError("argumentos invalidos");
+        } else {
+            std::vector<PersonaNombre> encontrados;
+            size_t filas = 0;
+            if (concurrente) {
+                // Cada persona se copia por separado; si otra conexión la eliminó entretanto, se omite
+                encontrados = concurrente->buscarPorNombre(std::string(texto), modo);
+                Estudiante est;
+                Instructor instr;
+                for (const PersonaNombre& p : encontrados) {
+                    if (p.esEstudiante ? concurrente->buscarEstudiante(p.id, est)
+                                       : concurrente->buscarInstructor(p.id, instr)) {
+                        if (p.esEstudiante) escribirEstudiante(est);
+                        else escribirInstructor(instr);
+                        filas++;
+                    }
+                }
+            } else {
+                encontrados = sistema->buscarPorNombre(std::string(texto), modo);
+                for (const PersonaNombre& p : encontrados) {
+                    if (p.esEstudiante) {
+                        escribirEstudiante(*sistema->buscarEstudiantePorId(p.id));
+                    } else {
+                        escribirInstructor(*sistema->buscarInstructorPorId(p.id));
+                    }
+                    vaciarSiCorresponde();
+                    filas++;
+                }
+            }
+            salida += "ok,";
+            escribirEntero((long long)filas);
+            salida += '\n';
+        }
+    } else if (comando == "buscar" || comando == "eliminar" || comando == "instructor" ||
+               comando == "eliminar_instructor") {
+        if (!leerId(siguienteCampo(resto), id) || !resto.empty()) {
+            escribirError("id invalido");
+        } else if (comando == "buscar") {
+            Estudiante copia;
+            const Estudiante* est = sistema ? sistema->buscarEstudiantePorId(id)
+                                  : concurrente->buscarEstudiante(id, copia) ? &copia : nullptr;
+            if (!est) {
+                escribirError("estudiante no encontrado");
+            } else {
+                escribirEstudiante(*est);
+                salida += "ok\n";
+            }
+        } else if (comando == "eliminar") {
+            std::string error;
+            if (sistema ? sistema->eliminarEstudiante(id, &error) : concurrente->eliminarEstudiante(id, &error)) {
+                salida += "ok\n";
+            } else {
+                escribirError(error);
+            }
+        } else if (comando == "instructor") {
+            Instructor copia;
+            const Instructor* instr = sistema ? sistema->buscarInstructorPorId(id)
+                                    : concurrente->buscarInstructor(id, copia) ? &copia : nullptr;
+            if (!instr) {
+                escribirError("instructor no encontrado");
+            } else {
+                escribirInstructor(*instr);
+                salida += "ok\n";
+            }
+        } else {
+            std::string error;
+            if (sistema ? sistema->eliminarInstructor(id, &error) : concurrente->eliminarInstructor(id, &error)) {
+                salida += "ok\n";
+            } else {
+                escribirError(error);
+            }
+        }
+    } else if (comando == "pagos") {
+        size_t filas;
+        if (concurrente) {
+            std::vector<PagoInstructor> pagos = concurrente->calcularPagos();
+            for (const PagoInstructor& p : pagos) {
+                escribirPago(p.id, p.nombre, p.tipoBaile, p.sueldoBruto, p.cotizacionAFP, p.sueldoLiquido);
+            }
+            filas = pagos.size();
+        } else {
+            MotorPagos motor;
+            sistema->calcularMotorPagos(motor);
+            for (size_t i = 0; i < motor.getCantidad(); i++) {
+                const Instructor* instr = motor.getInstructor(i);
+                escribirPago(instr->getId(), instr->getNombreCompleto(), instr->getTipoBaile(),
+                             motor.getSueldoBruto(i), motor.getCotizacionAFP(i), motor.getSueldoLiquido(i));
+                vaciarSiCorresponde();
+            }
+            filas = motor.getCantidad();
+        }
+        salida += "ok,";
+        escribirEntero((long long)filas);
+        salida += '\n';
+    } else if (comando == "listar") {
+        if (!resto.empty()) {
+            escribirError("argumentos invalidos");
+        } else if (concurrente) {
+            iniciarListado(0, UINT64_MAX, 0);
+        } else {
+            escribirEstudiantes(sistema->estudiantes());
+        }
+    } else if (comando == "rango") {
+        FechaHora desde, hasta;
+        uint8_t mascara = 0;
+        bool valido = leerFecha(siguienteCampo(resto), desde) && leerFecha(siguienteCampo(resto), hasta);
+        if (valido && !resto.empty()) {
+            EstiloBaile estilo;
+            valido = estiloDesdeTexto(siguienteCampo(resto), estilo);
+            if (valido) mascara = bitEstilo(estilo);
+        }
+        if (!valido || !resto.empty()) {
+            escribirError("argumentos invalidos");
+        } else if (concurrente) {
+            iniciarListado(RangoEstudiantes::claveDesde(desde), RangoEstudiantes::claveHasta(hasta), mascara);
+        } else {
+            escribirEstudiantes(sistema->estudiantesEntre(desde, hasta, mascara));
+        }
+    } else {
+        escribirError("comando desconocido");
+    }
+
+    vaciarSiCorresponde();
+    return numErrores == erroresPrevios;
+}
+
+void ProcesadorLotes::ejecutar(std::istream& entrada) {
+    std::string linea;
+    while (std::getline(entrada, linea)) {
+        ejecutarComando(linea);
+    }
+    vaciar();
+}
+
+size_t ProcesadorLotes::getNumComandos() const {
+    return numComandos;
+}
+
+size_t ProcesadorLotes::getNumErrores() const {
+    return numErrores;
+}
@@ -0,0 +1,160 @@
+#ifndef PROCESADOR_LOTES_H
+#define PROCESADOR_LOTES_H
+
+#include <cstdint>
+#include <cstdio>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <string_view>
+
+class Sistema;
+class SistemaConcurrente;
+class Estudiante;
+class Instructor;
+class RangoEstudiantes;
+class VersionEstudiantes;
+
+/**
+ * @class ProcesadorLotes
+ * @brief Ejecuta sobre un Sistema una secuencia de comandos de texto, sin menú ni preguntas.
+ *
+ * Cada línea es un comando con sus argumentos separados por comas:
+ *
+ *     matricular,<Nombre Apellido>,<MM/DD/YYYY HH:MM>,<Estilo>[|<Estilo>...]
+ *     buscar,<id>
+ *     eliminar,<id>
+ *     instructor,<id>
+ *     eliminar_instructor,<id>
+ *     pagos
+ *     listar
+ *     rango,<MM/DD/YYYY HH:MM>,<MM/DD/YYYY HH:MM>[,<Estilo>]
+ *     nombre,<texto>[,prefijo|apellido]
+ *
+ * Las líneas vacías y las que comienzan con '#' se ignoran. Cada comando responde con
+ * cero o más líneas de datos seguidas de una única línea de estado: "ok" (con el ID
+ * asignado en una matrícula o la cantidad de filas en un listado) o "error,<causa>".
+ * Una matrícula con un nombre ya registrado agrega antes la línea "aviso,nombre duplicado,<id>".
+ * Las respuestas se acumulan en un búfer que se vuelca por bloques, de modo que un lote
+ * grande no hace una escritura por comando.
+ *
+ * Los comandos usan las mismas operaciones del sistema que el menú, incluida la bitácora.
+ * Sin destino, las respuestas quedan en memoria hasta retirarlas con extraerSalida().
+ *
+ * Construido sobre un SistemaConcurrente, cada comando usa la operación tipada de la fachada
+ * con su bloqueo, y "listar" y "rango" recorren sin bloqueo la versión actual de los
+ * estudiantes. Esos listados se entregan por bloques de FILAS_POR_BLOQUE filas: el comando
+ * escribe el primero y cada llamada a continuarListado() agrega el siguiente, de modo que
+ * quien envía las respuestas nunca tiene un listado completo en memoria.
+ */
+class ProcesadorLotes {
+private:
+    Sistema* sistema;                   ///< Sistema usado directamente, o nullptr con fachada
+    SistemaConcurrente* concurrente;    ///< Fachada por la que pasan los comandos, o nullptr
+    std::FILE* destino;     ///< Destino de las respuestas, o nullptr para conservarlas en memoria
+    std::string salida;     ///< Respuestas pendientes de volcar
+    size_t numComandos;
+    size_t numErrores;
+
+    // Listado en curso sobre una versión de los estudiantes (solo con fachada)
+    std::shared_ptr<const VersionEstudiantes> listado;
+    uint64_t siguienteClave;    ///< Clave desde la que sigue el próximo bloque
+    uint64_t claveFinal;
+    uint8_t mascaraListado;
+    size_t filasListadas;
+
+    static const size_t CAPACIDAD_BUFFER = 1 << 16;
+
+    void escribirEntero(long long valor);
+    void escribirReal(double valor);
+    void escribirEstudiante(const Estudiante& est);
+    void escribirEstudiantes(const RangoEstudiantes& estudiantes);
+    void escribirInstructor(const Instructor& instr);
+    void escribirPago(int id, const std::string& nombre, const std::string& tipoBaile, double bruto,
+                      double cotizacion, double liquido);
+
+    /**
+     * @brief Comienza un listado por bloques sobre la versión actual y escribe el primer bloque.
+     */
+    void iniciarListado(uint64_t claveInicio, uint64_t claveFin, uint8_t mascara);
+
+    /**
+     * @brief Agrega la línea de estado de un comando fallido.
+     */
+    void escribirError(std::string_view causa);
+
+    /**
+     * @brief Vuelca el búfer al destino si superó su capacidad.
+     */
+    void vaciarSiCorresponde();
+
+public:
+    /**
+     * @param sistema Sistema ya cargado sobre el que se ejecutan los comandos.
+     * @param destino Archivo donde se escriben las respuestas (por ejemplo, stdout), o nullptr
+     *                para retirarlas con extraerSalida().
+     */
+    ProcesadorLotes(Sistema& sistema, std::FILE* destino);
+
+    /**
+     * @brief Ejecuta los comandos a través de la fachada concurrente, sin destino.
+     *
+     * Las respuestas se retiran con extraerSalida() y los listados se completan con continuarListado().
+     */
+    explicit ProcesadorLotes(SistemaConcurrente& concurrente);
+
+    /**
+     * @brief Vuelca las respuestas pendientes.
+     */
+    ~ProcesadorLotes();
+
+    ProcesadorLotes(const ProcesadorLotes&) = delete;
+    ProcesadorLotes& operator=(const ProcesadorLotes&) = delete;
+
+    /**
+     * @brief Ejecuta un comando y agrega su respuesta al búfer.
+     *
+     * Si quedaba un listado pendiente, primero se completa, para no mezclar respuestas.
+     *
+     * @param linea Línea del comando, sin el salto de línea final.
+     * @return false si el comando terminó con error; las líneas ignoradas cuentan como correctas.
+     */
+    bool ejecutarComando(std::string_view linea);
+
+    /**
+     * @brief Indica si el último comando dejó filas de un listado por escribir.
+     */
+    bool hayListadoPendiente() const;
+
+    /**
+     * @brief Agrega el siguiente bloque del listado pendiente y, al terminarlo, su línea "ok".
+     */
+    void continuarListado();
+
+    /**
+     * @brief Lee y ejecuta comandos hasta el final de la entrada.
+     *
+     * @param entrada Flujo con un comando por línea.
+     */
+    void ejecutar(std::istream& entrada);
+
+    /**
+     * @brief Escribe en el destino todas las respuestas pendientes.
+     */
+    void vaciar();
+
+    /**
+     * @brief Entrega las respuestas acumuladas y vacía el búfer; pensado para usar sin destino.
+     *
+     * @param respuestas Recibe las respuestas (su contenido anterior se descarta).
+     */
+    void extraerSalida(std::string& respuestas);
+
+    size_t getNumComandos() const;
+    size_t getNumErrores() const;
+
+    /// Filas de estudiantes por bloque de un listado sobre la fachada
+    static const size_t FILAS_POR_BLOQUE = 512;
+};
+
+#endif // PROCESADOR_LOTES_H
@@ -0,0 +1,110 @@
+#include "RangoEstudiantes.h"
+
+IteradorRangoEstudiantes::IteradorRangoEstudiantes()
+    : tope(0), claveFin(0), mascaraFiltro(0) {}
+
+/**
+ * @brief Busca la cota inferior apilando solo los nodos con clave >= claveInicio.
+ *
+ * Al bajar a la izquierda el nodo queda pendiente (es mayor que todo lo que sigue);
+ * al bajar a la derecha se descarta, porque es menor que el inicio del rango.
+ */
+IteradorRangoEstudiantes::IteradorRangoEstudiantes(NodoAVL_Estudiantes* raiz, uint64_t claveInicio,
+                                                   uint64_t claveFin, uint8_t mascaraFiltro)
+    : tope(0), claveFin(claveFin), mascaraFiltro(mascaraFiltro) {
+    NodoAVL_Estudiantes* actual = raiz;
+    while (actual) {
+        if (actual->clave >= claveInicio) {
+            pila[tope++] = actual;
+            actual = actual->izquierdo;
+        } else {
+            actual = actual->derecho;
+        }
+    }
+    ajustar();
+}
+
+IteradorRangoEstudiantes::reference IteradorRangoEstudiantes::operator*() const {
+    return *pila[tope - 1]->estudiante;
+}
+
+IteradorRangoEstudiantes::pointer IteradorRangoEstudiantes::operator->() const {
+    return pila[tope - 1]->estudiante;
+}
+
+NodoAVL_Estudiantes* IteradorRangoEstudiantes::nodo() const {
+    return pila[tope - 1];
+}
+
+IteradorRangoEstudiantes& IteradorRangoEstudiantes::operator++() {
+    avanzarNodo();
+    ajustar();
+    return *this;
+}
+
+IteradorRangoEstudiantes IteradorRangoEstudiantes::operator++(int) {
+    IteradorRangoEstudiantes anterior = *this;
+    ++*this;
+    return anterior;
+}
+
+/**
+ * @brief Dos iteradores son iguales si ambos terminaron o apuntan al mismo nodo.
+ */
+bool IteradorRangoEstudiantes::operator==(const IteradorRangoEstudiantes& otro) const {
+    if (tope == 0 || otro.tope == 0) return tope == otro.tope;
+    return pila[tope - 1] == otro.pila[otro.tope - 1];
+}
+
+bool IteradorRangoEstudiantes::operator!=(const IteradorRangoEstudiantes& otro) const {
+    return !(*this == otro);
+}
+
+void IteradorRangoEstudiantes::apilarIzquierdos(NodoAVL_Estudiantes* nodo) {
+    while (nodo) {
+        pila[tope++] = nodo;
+        nodo = nodo->izquierdo;
+    }
+}
+
+void IteradorRangoEstudiantes::avanzarNodo() {
+    NodoAVL_Estudiantes* actual = pila[--tope];
+    apilarIzquierdos(actual->derecho);
+}
+
+void IteradorRangoEstudiantes::ajustar() {
+    while (tope > 0) {
+        NodoAVL_Estudiantes* actual = pila[tope - 1];
+        if (actual->clave > claveFin) {
+            tope = 0;
+            return;
+        }
+        if (mascaraFiltro == 0 || (actual->estudiante->getMascaraPreferencias() & mascaraFiltro)) return;
+        avanzarNodo();
+    }
+}
+
+RangoEstudiantes::RangoEstudiantes(NodoAVL_Estudiantes* raiz)
+    : raiz(raiz), claveInicio(0), claveFin(UINT64_MAX), mascaraFiltro(0) {}
+
+RangoEstudiantes::RangoEstudiantes(NodoAVL_Estudiantes* raiz, uint64_t claveInicio, uint64_t claveFin,
+                                   uint8_t mascaraFiltro)
+    : raiz(raiz), claveInicio(claveInicio), claveFin(claveFin), mascaraFiltro(mascaraFiltro) {}
+
+uint64_t RangoEstudiantes::claveDesde(const FechaHora& fecha) {
+    return NodoAVL_Estudiantes::generarClave(fecha.anio, fecha.mes, fecha.dia, fecha.hora, fecha.minuto, 0);
+}
+
+uint64_t RangoEstudiantes::claveHasta(const FechaHora& fecha) {
+    return NodoAVL_Estudiantes::generarClave(fecha.anio, fecha.mes, fecha.dia, fecha.hora, fecha.minuto,
+                                             (int)NodoAVL_Estudiantes::MASCARA_ID);
+}
+
+IteradorRangoEstudiantes RangoEstudiantes::begin() const {
+    if (claveInicio > claveFin) return IteradorRangoEstudiantes();
+    return IteradorRangoEstudiantes(raiz, claveInicio, claveFin, mascaraFiltro);
+}
+
+IteradorRangoEstudiantes RangoEstudiantes::end() const {
+    return IteradorRangoEstudiantes();
+}
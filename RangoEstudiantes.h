@@ -0,0 +1,135 @@
+#ifndef RANGO_ESTUDIANTES_H
+#define RANGO_ESTUDIANTES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include "NodoAVL_Estudiantes.h"
+
+/**
+ * @brief Fecha y hora de matrícula con precisión de minutos, usada como límite de consultas.
+ */
+struct FechaHora {
+    int dia;
+    int mes;
+    int anio;
+    int hora;
+    int minuto;
+};
+
+/**
+ * @class IteradorRangoEstudiantes
+ * @brief Iterador en orden sobre los estudiantes del AVL cuya clave está en [claveInicio, claveFin].
+ *
+ * Es el recorrido en orden común a todo el sistema: listados, exportación a CSV, snapshot
+ * y consultas por fecha. No reserva memoria ni usa recursión.
+ *
+ * Guarda en una pila de tamaño fijo los ancestros pendientes de visitar. Construirlo
+ * desciende una sola vez hasta la primera clave mayor o igual a claveInicio (O(log n)),
+ * y cada avance es O(1) amortizado, de modo que recorrer k estudiantes cuesta O(log n + k).
+ * Los estudiantes se entregan a medida que se avanza, sin copiarlos a una lista. Cada copia
+ * del iterador tiene su propia pila, por lo que admite varias pasadas (iterador de avance).
+ *
+ * Si hay un filtro de preferencias, se omiten los estudiantes que no prefieren ninguno
+ * de los estilos de la máscara. El iterador queda invalidado si el árbol se modifica.
+ */
+class IteradorRangoEstudiantes {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Estudiante;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Estudiante*;
+    using reference = const Estudiante&;
+
+    /// Capacidad de la pila, que nunca supera la altura del árbol. Un AVL de altura 64
+    /// necesitaría más de 2^44 nodos, muy por encima de los 2^30 IDs posibles.
+    static const int ALTURA_MAXIMA = 64;
+
+    /**
+     * @brief Construye el iterador de fin.
+     */
+    IteradorRangoEstudiantes();
+
+    /**
+     * @brief Se ubica en el primer estudiante del rango que cumple el filtro.
+     *
+     * @param raiz Raíz del AVL de estudiantes.
+     * @param claveInicio Clave mínima, incluida.
+     * @param claveFin Clave máxima, incluida.
+     * @param mascaraFiltro Máscara de estilos aceptados; 0 acepta a todos.
+     */
+    IteradorRangoEstudiantes(NodoAVL_Estudiantes* raiz, uint64_t claveInicio, uint64_t claveFin,
+                             uint8_t mascaraFiltro);
+
+    reference operator*() const;
+    pointer operator->() const;
+
+    /**
+     * @brief Nodo actual (por ejemplo, para consultar su clave).
+     */
+    NodoAVL_Estudiantes* nodo() const;
+
+    IteradorRangoEstudiantes& operator++();
+    IteradorRangoEstudiantes operator++(int);
+
+    bool operator==(const IteradorRangoEstudiantes& otro) const;
+    bool operator!=(const IteradorRangoEstudiantes& otro) const;
+
+private:
+    NodoAVL_Estudiantes* pila[ALTURA_MAXIMA];   ///< Ancestros pendientes; la cima es el nodo actual
+    int tope;                                   ///< Cantidad de nodos en la pila (0 = fin)
+    uint64_t claveFin;
+    uint8_t mascaraFiltro;
+
+    /**
+     * @brief Apila el camino hacia la izquierda desde `nodo`.
+     */
+    void apilarIzquierdos(NodoAVL_Estudiantes* nodo);
+
+    /**
+     * @brief Quita el nodo actual y deja en la cima su sucesor en orden.
+     */
+    void avanzarNodo();
+
+    /**
+     * @brief Avanza hasta un nodo que cumpla el filtro, o termina si se pasa de claveFin.
+     */
+    void ajustar();
+};
+
+/**
+ * @class RangoEstudiantes
+ * @brief Rango perezoso de estudiantes entre dos claves, utilizable en un for de rango
+ *        y con los algoritmos estándar.
+ */
+class RangoEstudiantes {
+private:
+    NodoAVL_Estudiantes* raiz;
+    uint64_t claveInicio;
+    uint64_t claveFin;
+    uint8_t mascaraFiltro;
+
+public:
+    /**
+     * @brief Rango con todos los estudiantes del árbol, en orden de matrícula.
+     */
+    explicit RangoEstudiantes(NodoAVL_Estudiantes* raiz);
+
+    RangoEstudiantes(NodoAVL_Estudiantes* raiz, uint64_t claveInicio, uint64_t claveFin,
+                     uint8_t mascaraFiltro);
+
+    /**
+     * @brief Clave del primer instante de una fecha y hora (ID 0).
+     */
+    static uint64_t claveDesde(const FechaHora& fecha);
+
+    /**
+     * @brief Clave del último instante de una fecha y hora (ID máximo), para un límite incluido.
+     */
+    static uint64_t claveHasta(const FechaHora& fecha);
+
+    IteradorRangoEstudiantes begin() const;
+    IteradorRangoEstudiantes end() const;
+};
+
+#endif // RANGO_ESTUDIANTES_H
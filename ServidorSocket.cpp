@@ -0,0 +1,397 @@
+#include "ServidorSocket.h"
+#include "ProcesadorLotes.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+#ifndef _WIN32
+#include <csignal>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Estado de una conexión abierta.
+ *
+ * Los campos se protegen con mutexConexiones, salvo `lote`: lo usa sin el mutex el
+ * trabajador que tiene la conexión (enTrabajo), y con el mutex quien la consulte mientras
+ * no la tiene nadie.
+ */
+struct ServidorSocket::Conexion {
+    int descriptor;
+    ProcesadorLotes lote;
+    std::string entrada;                ///< Bytes recibidos después del último salto de línea
+    std::deque<std::string> comandos;   ///< Líneas completas por ejecutar, en orden
+    std::string salida;                 ///< Respuestas por enviar
+    bool enTrabajo;                     ///< En la cola de listas o en manos de un trabajador
+    bool finEntrada;                    ///< No se leerá más: el cliente cerró su envío o falló
+    bool lineaLarga;                    ///< Llegó una línea demasiado larga; se informa al final
+    bool descartando;                   ///< Después de esa línea se descarta lo recibido
+    bool fallida;                       ///< Error de lectura o escritura: se cierra sin enviar más
+
+    Conexion(int descriptor, SistemaConcurrente& concurrente)
+        : descriptor(descriptor), lote(concurrente), enTrabajo(false), finEntrada(false),
+          lineaLarga(false), descartando(false), fallida(false) {}
+};
+
+namespace {
+
+#ifndef _WIN32
+// Llena la dirección del socket; falla si la ruta no cabe en sun_path
+bool direccionSocket(const std::string& ruta, sockaddr_un& direccion) {
+    std::memset(&direccion, 0, sizeof(direccion));
+    direccion.sun_family = AF_UNIX;
+    if (ruta.empty() || ruta.size() >= sizeof(direccion.sun_path)) return false;
+    std::memcpy(direccion.sun_path, ruta.c_str(), ruta.size() + 1);
+    return true;
+}
+
+bool noBloqueante(int descriptor) {
+    int banderas = fcntl(descriptor, F_GETFL);
+    return banderas >= 0 && fcntl(descriptor, F_SETFL, banderas | O_NONBLOCK) == 0 &&
+           fcntl(descriptor, F_SETFD, FD_CLOEXEC) == 0;
+}
+#endif
+
+} // namespace
+
+ServidorSocket::ServidorSocket(Sistema& sistema, const std::string& ruta, int numHilos)
+    : concurrente(sistema), ruta(ruta), numHilos(numHilos), descriptorEscucha(-1), avisoLectura(-1),
+      avisoEscritura(-1), detenido(false), cerrando(false), numConexiones(0), numComandos(0) {
+    if (this->numHilos <= 0) this->numHilos = std::max(2, (int)std::thread::hardware_concurrency());
+}
+
+ServidorSocket::~ServidorSocket() {
+#ifndef _WIN32
+    if (descriptorEscucha >= 0) {
+        close(descriptorEscucha);
+        unlink(ruta.c_str());
+    }
+#endif
+}
+
+void ServidorSocket::detener() {
+    detenido.store(true, std::memory_order_release);
+}
+
+size_t ServidorSocket::getNumConexiones() const {
+    return numConexiones.load(std::memory_order_relaxed);
+}
+
+size_t ServidorSocket::getNumComandos() const {
+    return numComandos.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Toma una conexión lista, ejecuta un solo comando o bloque de listado y la devuelve.
+ *
+ * El comando se ejecuta sin mutexConexiones; la fachada toma el bloqueo que corresponda.
+ */
+void ServidorSocket::trabajador() {
+    std::string linea;
+    std::string respuesta;
+    for (;;) {
+        Conexion* conexion;
+        bool continuar;
+        {
+            std::unique_lock<std::mutex> guardia(mutexConexiones);
+            hayTrabajo.wait(guardia, [this] { return cerrando || !listas.empty(); });
+            if (cerrando) return;
+            conexion = listas.front();
+            listas.pop_front();
+            continuar = conexion->lote.hayListadoPendiente();
+            if (!continuar) {
+                linea = std::move(conexion->comandos.front());
+                conexion->comandos.pop_front();
+            }
+        }
+
+        ProcesadorLotes& lote = conexion->lote;
+        const size_t previos = lote.getNumComandos();
+        if (continuar) lote.continuarListado();
+        else lote.ejecutarComando(linea);
+        numComandos.fetch_add(lote.getNumComandos() - previos, std::memory_order_relaxed);
+        lote.extraerSalida(respuesta);
+
+        {
+            std::lock_guard<std::mutex> guardia(mutexConexiones);
+            conexion->salida += respuesta;
+            conexion->enTrabajo = false;
+            programar(*conexion);
+        }
+        despertar();
+    }
+}
+
+/**
+ * @brief Vuelve al final de la cola, para repartir los trabajadores entre las conexiones.
+ *
+ * Sin comandos pendientes, informa aquí la línea demasiado larga, ya respondidas las anteriores.
+ */
+void ServidorSocket::programar(Conexion& conexion) {
+    if (conexion.enTrabajo || conexion.fallida) return;
+    if (conexion.comandos.empty() && !conexion.lote.hayListadoPendiente()) {
+        if (conexion.lineaLarga) {
+            conexion.salida += "error,linea demasiado larga\n";
+            conexion.lineaLarga = false;
+        }
+        return;
+    }
+    if (conexion.salida.size() >= SALIDA_MAXIMA) return;
+    conexion.enTrabajo = true;
+    listas.push_back(&conexion);
+    hayTrabajo.notify_one();
+}
+
+#ifdef _WIN32
+
+bool ServidorSocket::iniciar(std::string& error) {
+    error = "el modo servidor requiere sockets de dominio Unix, no disponibles en esta plataforma";
+    return false;
+}
+
+void ServidorSocket::ejecutar() {}
+
+void ServidorSocket::despertar() {}
+
+void ServidorSocket::aceptarConexiones() {}
+
+void ServidorSocket::leerConexion(Conexion&) {}
+
+void ServidorSocket::enviarConexion(Conexion&) {}
+
+void ServidorSocket::cerrarConexiones() {}
+
+#else
+
+/**
+ * @brief Crea, enlaza y pone a escuchar el socket, descartando un archivo de socket abandonado.
+ *
+ * Solo se borra una ruta existente si es un socket; cualquier otro archivo es un error.
+ */
+bool ServidorSocket::iniciar(std::string& error) {
+    sockaddr_un direccion;
+    if (!direccionSocket(ruta, direccion)) {
+        error = "ruta de socket vacia o demasiado larga";
+        return false;
+    }
+
+    // Un socket que nadie atiende quedó de una ejecución anterior y se puede reemplazar
+    struct stat info;
+    if (lstat(ruta.c_str(), &info) == 0) {
+        if (!S_ISSOCK(info.st_mode)) {
+            error = ruta + " ya existe y no es un socket";
+            return false;
+        }
+        int prueba = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (prueba >= 0) {
+            bool ocupado = connect(prueba, (const sockaddr*)&direccion, sizeof(direccion)) == 0;
+            close(prueba);
+            if (ocupado) {
+                error = "ya hay un servidor escuchando en " + ruta;
+                return false;
+            }
+        }
+        unlink(ruta.c_str());
+    }
+
+    descriptorEscucha = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (descriptorEscucha < 0) {
+        error = std::string("no se pudo crear el socket: ") + std::strerror(errno);
+        return false;
+    }
+    if (bind(descriptorEscucha, (const sockaddr*)&direccion, sizeof(direccion)) != 0 ||
+        listen(descriptorEscucha, 64) != 0) {
+        error = std::string("no se pudo escuchar en ") + ruta + ": " + std::strerror(errno);
+        close(descriptorEscucha);
+        descriptorEscucha = -1;
+        return false;
+    }
+    // Un cliente que cierra antes de leer su respuesta no debe terminar el proceso
+    std::signal(SIGPIPE, SIG_IGN);
+    return true;
+}
+
+/**
+ * @brief Lanza los trabajadores y atiende los eventos de todas las conexiones hasta que se
+ *        pida detener el servidor.
+ *
+ * La espera se corta cada 200 ms para revisar si se llamó a detener(). Una conexión se
+ * espera para lectura mientras no tenga demasiados comandos acumulados y para escritura
+ * mientras tenga respuestas pendientes; se cierra cuando el cliente terminó de enviar y
+ * ya recibió todo.
+ */
+void ServidorSocket::ejecutar() {
+    if (descriptorEscucha < 0) return;
+    int aviso[2];
+    if (pipe(aviso) != 0) {
+        std::cerr << "No se pudo crear la tuberia de avisos: " << std::strerror(errno) << "\n";
+        return;
+    }
+    avisoLectura = aviso[0];
+    avisoEscritura = aviso[1];
+    noBloqueante(avisoLectura);
+    noBloqueante(avisoEscritura);
+    noBloqueante(descriptorEscucha);
+
+    std::vector<std::thread> trabajadores;
+    for (int i = 0; i < numHilos; i++) trabajadores.emplace_back(&ServidorSocket::trabajador, this);
+
+    std::vector<pollfd> esperas;
+    while (!detenido.load(std::memory_order_acquire)) {
+        esperas.clear();
+        esperas.push_back(pollfd{avisoLectura, POLLIN, 0});
+        esperas.push_back(pollfd{descriptorEscucha, POLLIN, 0});
+        {
+            std::lock_guard<std::mutex> guardia(mutexConexiones);
+            for (const std::unique_ptr<Conexion>& c : conexiones) {
+                short eventos = 0;
+                if (!c->finEntrada && c->comandos.size() < COMANDOS_MAXIMOS) eventos |= POLLIN;
+                if (!c->fallida && !c->salida.empty()) eventos |= POLLOUT;
+                // Un descriptor negativo mantiene la posición sin esperar nada de esa conexión
+                esperas.push_back(pollfd{eventos ? c->descriptor : -1, eventos, 0});
+            }
+        }
+        if (poll(esperas.data(), esperas.size(), 200) < 0) continue;
+
+        if (esperas[0].revents) {
+            char descarte[256];
+            while (read(avisoLectura, descarte, sizeof(descarte)) > 0) {
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> guardia(mutexConexiones);
+            for (size_t i = 0; i < conexiones.size(); i++) {
+                Conexion& c = *conexiones[i];
+                const short ocurridos = esperas[i + 2].revents;
+                if (ocurridos & (POLLIN | POLLHUP | POLLERR)) leerConexion(c);
+                if (ocurridos & POLLOUT) enviarConexion(c);
+                programar(c);
+            }
+            // Se quitan las terminadas que ningún trabajador está usando; el procesador de una
+            // conexión en trabajo no se consulta, porque lo está usando el trabajador
+            for (size_t i = 0; i < conexiones.size();) {
+                Conexion& c = *conexiones[i];
+                const bool terminada =
+                    !c.enTrabajo && (c.fallida || (c.finEntrada && c.comandos.empty() && !c.lineaLarga &&
+                                                   !c.lote.hayListadoPendiente() && c.salida.empty()));
+                if (terminada) {
+                    close(c.descriptor);
+                    conexiones[i] = std::move(conexiones.back());
+                    conexiones.pop_back();
+                } else {
+                    i++;
+                }
+            }
+        }
+
+        if (esperas[1].revents & POLLIN) aceptarConexiones();
+    }
+
+    cerrarConexiones();
+    for (std::thread& t : trabajadores) t.join();
+    for (const std::unique_ptr<Conexion>& c : conexiones) close(c->descriptor);
+    conexiones.clear();
+    close(avisoLectura);
+    close(avisoEscritura);
+    avisoLectura = avisoEscritura = -1;
+}
+
+void ServidorSocket::despertar() {
+    // Si la tubería está llena ya hay un aviso pendiente y el fallo se puede ignorar
+    const char aviso = 1;
+    if (write(avisoEscritura, &aviso, 1) < 0) return;
+}
+
+void ServidorSocket::aceptarConexiones() {
+    for (;;) {
+        int descriptor = accept(descriptorEscucha, nullptr, nullptr);
+        if (descriptor < 0) {
+            if (errno == EINTR) continue;
+            return;
+        }
+        if (!noBloqueante(descriptor)) {
+            close(descriptor);
+            continue;
+        }
+        numConexiones.fetch_add(1, std::memory_order_relaxed);
+        conexiones.push_back(std::make_unique<Conexion>(descriptor, concurrente));
+    }
+}
+
+/**
+ * @brief Lee hasta vaciar el socket y pasa cada línea completa a la cola de comandos.
+ */
+void ServidorSocket::leerConexion(Conexion& conexion) {
+    char bloque[4096];
+    while (!conexion.finEntrada) {
+        ssize_t leidos = recv(conexion.descriptor, bloque, sizeof(bloque), 0);
+        if (leidos < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            conexion.fallida = true;
+            conexion.finEntrada = true;
+            break;
+        }
+        if (leidos == 0) {
+            conexion.finEntrada = true;
+            break;
+        }
+
+        if (conexion.descartando) continue;
+        std::string& entrada = conexion.entrada;
+        entrada.append(bloque, (size_t)leidos);
+        size_t inicio = 0;
+        size_t fin;
+        while ((fin = entrada.find('\n', inicio)) != std::string::npos) {
+            conexion.comandos.emplace_back(entrada, inicio, fin - inicio);
+            inicio = fin + 1;
+        }
+        entrada.erase(0, inicio);
+        if (entrada.size() > LINEA_MAXIMA) {
+            // El error se envía cuando se respondan los comandos anteriores; lo que siga se
+            // lee y se descarta, porque cerrar con datos sin leer haría perder esa respuesta
+            entrada.clear();
+            conexion.lineaLarga = true;
+            conexion.descartando = true;
+        }
+    }
+}
+
+void ServidorSocket::enviarConexion(Conexion& conexion) {
+    size_t enviado = 0;
+    while (enviado < conexion.salida.size()) {
+        ssize_t n = send(conexion.descriptor, conexion.salida.data() + enviado, conexion.salida.size() - enviado,
+                         0);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            conexion.fallida = true;
+            conexion.finEntrada = true;
+            conexion.salida.clear();
+            return;
+        }
+        enviado += (size_t)n;
+    }
+    conexion.salida.erase(0, enviado);
+    // Enviado el error de la línea larga, el cliente recibe el fin de la conexión
+    if (conexion.salida.empty() && conexion.descartando && !conexion.lineaLarga) {
+        shutdown(conexion.descriptor, SHUT_WR);
+    }
+}
+
+void ServidorSocket::cerrarConexiones() {
+    std::lock_guard<std::mutex> guardia(mutexConexiones);
+    cerrando = true;
+    listas.clear();
+    hayTrabajo.notify_all();
+}
+
+#endif
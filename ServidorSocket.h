@@ -0,0 +1,154 @@
+#ifndef SERVIDOR_SOCKET_H
+#define SERVIDOR_SOCKET_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "SistemaConcurrente.h"
+
+/**
+ * @class ServidorSocket
+ * @brief Atiende comandos sobre un socket de dominio Unix, con los datos cargados una sola vez.
+ *
+ * Cada conexión envía comandos con el mismo formato de ProcesadorLotes, uno por línea, y
+ * recibe la misma respuesta que el modo por lotes: cero o más líneas de datos y una línea
+ * de estado que comienza con "ok" o "error". Un cliente puede enviar varios comandos
+ * seguidos sin esperar cada respuesta; se responden en orden.
+ *
+ * Un hilo de eventos espera con poll() sobre el socket de escucha y todas las conexiones:
+ * acepta, lee las líneas completas y envía las respuestas, sin bloquearse en ningún cliente.
+ * Un grupo fijo de trabajadores ejecuta los comandos de a uno: toma una conexión con trabajo,
+ * ejecuta su siguiente comando (o el siguiente bloque de un listado) y la devuelve al final
+ * de la cola, así que un cliente inactivo no ocupa un trabajador y uno con un lote largo no
+ * acapara a los demás. Una conexión tiene a lo sumo un comando en ejecución, lo que conserva
+ * el orden de sus respuestas.
+ *
+ * Los comandos usan las operaciones tipadas de SistemaConcurrente (ver
+ * ProcesadorLotes(SistemaConcurrente&)): las consultas con el bloqueo compartido, las
+ * modificaciones con el exclusivo y los listados sobre una versión inmutable, por bloques.
+ * Nada se envía con un bloqueo tomado. Si un cliente no lee sus respuestas y acumula más de
+ * SALIDA_MAXIMA bytes pendientes, no se ejecutan más comandos suyos hasta que lea.
+ *
+ * Solo está disponible en sistemas POSIX; en Windows iniciar() informa el error.
+ */
+class ServidorSocket {
+private:
+    struct Conexion;
+
+    SistemaConcurrente concurrente;
+    std::string ruta;
+    int numHilos;
+    int descriptorEscucha;              ///< Socket de escucha, o -1 si no se inició
+    int avisoLectura;                   ///< Tubería con la que los trabajadores despiertan al hilo de eventos
+    int avisoEscritura;
+
+    std::atomic<bool> detenido;         ///< Lo activa detener(), incluso desde un manejador de señales
+
+    /// Protege las colas y los campos de cada Conexion, salvo su procesador (ver Conexion)
+    std::mutex mutexConexiones;
+    std::condition_variable hayTrabajo;
+    std::deque<Conexion*> listas;       ///< Conexiones con un comando por ejecutar, en orden de llegada
+    bool cerrando;                      ///< Los trabajadores deben terminar
+
+    /// Conexiones abiertas; solo el hilo de eventos agrega y quita elementos
+    std::vector<std::unique_ptr<Conexion>> conexiones;
+
+    std::atomic<size_t> numConexiones;
+    std::atomic<size_t> numComandos;
+
+    /// Longitud máxima de una línea de comando; tras una más larga se responde un error y se deja de atender
+    static const size_t LINEA_MAXIMA = 1 << 16;
+
+    /// Respuestas pendientes de enviar a partir de las cuales una conexión deja de ejecutar comandos
+    static const size_t SALIDA_MAXIMA = 1 << 18;
+
+    /// Comandos recibidos sin ejecutar a partir de los cuales se deja de leer una conexión
+    static const size_t COMANDOS_MAXIMOS = 256;
+
+    /**
+     * @brief Ejecuta comandos de las conexiones listas hasta que el servidor se cierre.
+     */
+    void trabajador();
+
+    /**
+     * @brief Encola la conexión para un trabajador si tiene un comando por ejecutar y no
+     *        está esperando que el cliente lea. Requiere mutexConexiones.
+     */
+    void programar(Conexion& conexion);
+
+    /**
+     * @brief Despierta al hilo de eventos para que envíe respuestas o cierre conexiones.
+     */
+    void despertar();
+
+    /**
+     * @brief Acepta todas las conexiones pendientes del socket de escucha.
+     */
+    void aceptarConexiones();
+
+    /**
+     * @brief Lee lo disponible de una conexión y separa las líneas completas. Requiere mutexConexiones.
+     */
+    void leerConexion(Conexion& conexion);
+
+    /**
+     * @brief Envía lo que el socket acepte de las respuestas pendientes. Requiere mutexConexiones.
+     */
+    void enviarConexion(Conexion& conexion);
+
+    /**
+     * @brief Detiene a los trabajadores y cierra todas las conexiones.
+     */
+    void cerrarConexiones();
+
+public:
+    /**
+     * @param sistema Sistema ya cargado; no debe usarse directamente mientras el servidor exista.
+     * @param ruta Ruta del socket en el sistema de archivos.
+     * @param numHilos Cantidad de trabajadores (0 = uno por núcleo, al menos 2).
+     *                 No limita la cantidad de clientes conectados.
+     */
+    ServidorSocket(Sistema& sistema, const std::string& ruta, int numHilos = 0);
+
+    /**
+     * @brief Cierra el socket de escucha y borra su archivo.
+     */
+    ~ServidorSocket();
+
+    ServidorSocket(const ServidorSocket&) = delete;
+    ServidorSocket& operator=(const ServidorSocket&) = delete;
+
+    /**
+     * @brief Crea el socket y comienza a escuchar en la ruta.
+     *
+     * Si la ruta es un socket en el que ningún servidor responde (quedó de una ejecución
+     * interrumpida), se reemplaza; si otro servidor la está usando, o si es un archivo que
+     * no es un socket, es un error y no se toca.
+     *
+     * @param error Recibe la causa si no se pudo iniciar.
+     * @return true si el servidor quedó escuchando.
+     */
+    bool iniciar(std::string& error);
+
+    /**
+     * @brief Atiende conexiones hasta que se llame a detener(); al volver, todos los hilos
+     *        terminaron y las conexiones se cerraron (las respuestas sin enviar se descartan).
+     */
+    void ejecutar();
+
+    /**
+     * @brief Pide al servidor que termine. Solo modifica un indicador atómico, por lo que
+     *        puede llamarse desde un manejador de señales.
+     */
+    void detener();
+
+    size_t getNumConexiones() const;
+    size_t getNumComandos() const;
+};
+
+#endif // SERVIDOR_SOCKET_H
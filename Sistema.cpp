@@ -1,90 +1,197 @@
 #include "Sistema.h"
+#include "ArchivoMapeado.h"
+#include "EscritorAtomico.h"
+#include "LectorCSV.h"
+#include "MotorPagos.h"
+#include "Snapshot.h"
 #include <iostream>
-#include <fstream>
 #include <sstream>
 #include <ctime>
-#include <functional>
 #include <string.h>
+#include <algorithm>
+#include <filesystem>
+#include <iterator>
+#include <thread>
+#include <vector>
 /**
  * @brief Constructor de la clase Sistema.
  *        Inicializa las raíces del árbol binario de búsqueda (ABB) y del árbol AVL en nullptr.
  *
+ * @param directorioDatos Directorio donde se leen y escriben los archivos de datos.
  * @return Una nueva instancia de la clase Sistema con las raíces de los árboles sin inicializar.
  */
-Sistema::Sistema() : raizABB(nullptr), raizAVL(nullptr) {}
+Sistema::Sistema(const std::string& directorioDatos)
+    : raizABB(nullptr), raizAVL(nullptr), indiceNombresListo(false), conteoEstilos{}, hilosCarga(0),
+      directorioDatos(directorioDatos) {}
+
+/**
+ * @brief Construye la ruta completa de un archivo dentro del directorio de datos.
+ *
+ * @param nombreArchivo Nombre del archivo, por ejemplo "estudiantes.csv".
+ * @return La ruta del archivo.
+ */
+std::string Sistema::rutaDatos(const char* nombreArchivo) const {
+    return directorioDatos + nombreArchivo;
+}
+
+// Libera en postorden todos los nodos del ABB de instructores (cada nodo libera su instructor)
+static void liberarABB(NodoABB_Instructores* nodo) {
+    if (!nodo) return;
+    liberarABB(nodo->izquierdo);
+    liberarABB(nodo->derecho);
+    delete nodo;
+}
 
 /**
  * @brief Destructor de la clase Sistema.
  *        Libera los recursos utilizados por la instancia de la clase Sistema.
+ *
+ * Los instructores se liberan recorriendo el ABB; los estudiantes y sus nodos AVL
+ * pertenecen a poolEstudiantes, que los libera en bloque al destruirse.
  */
 Sistema::~Sistema() {
+    liberarABB(raizABB);
+    raizABB = nullptr;
+    raizAVL = nullptr;
+}
 
+// Escribe los estudiantes en orden de matrícula
+static void guardarEstudiantesCSV(const RangoEstudiantes& estudiantes, EscritorAtomico& salida) {
+    for (const Estudiante& e : estudiantes) {
+        // Formato: ID,Nombre,MM/DD/YYYY HH:MM,Pref1|Pref2|Pref3
+        // ID y nombre
+        salida.escribirEntero(e.getId());
+        salida.escribir(',');
+        salida.escribir(e.getNombre());
+        salida.escribir(',');
+        // Fecha y hora de ancho fijo
+        salida.escribirEnteroFijo(e.getMes(), 2);
+        salida.escribir('/');
+        salida.escribirEnteroFijo(e.getDia(), 2);
+        salida.escribir('/');
+        salida.escribirEnteroFijo(e.getAnio(), 4);
+        salida.escribir(' ');
+        salida.escribirEnteroFijo(e.getHora(), 2);
+        salida.escribir(':');
+        salida.escribirEnteroFijo(e.getMinuto(), 2);
+        salida.escribir(',');
+        // Preferencias
+        for (int i = 0; i < e.getNumPreferencias(); ++i) {
+            if (i > 0) salida.escribir('|');
+            salida.escribir(e.getPreferencia(i));
+        }
+        salida.escribir('\n');
+    }
 }
 
-static void guardarInOrderAVL(NodoAVL_Estudiantes* nodo, std::ofstream& fout) {
-    if (!nodo) return;
-    // subárbol izquierdo
-    guardarInOrderAVL(nodo->izquierdo, fout);
-    Estudiante* e = nodo->estudiante;
-    // Formato: ID,Nombre,MM/DD/YYYY HH:MM,Pref1|Pref2|Pref3
-    // ID y nombre
-    fout << e->getId() << "," << e->getNombre() << ",";
-    // Fecha
-    fout << (e->getMes() < 10 ? "0" : "") << e->getMes() << "/"
-         << (e->getDia() < 10 ? "0" : "") << e->getDia() << "/"
-         << e->getAnio() << " ";
-    // Hora
-    fout << (e->getHora() < 10 ? "0" : "") << e->getHora() << ":"
-         << (e->getMinuto() < 10 ? "0" : "") << e->getMinuto() << ",";
-    // Preferencias
-    for (int i = 0; i < e->getNumPreferencias(); ++i) {
-        fout << e->getPreferencia(i);
-        if (i < e->getNumPreferencias() - 1) fout << "|";
-    }
-    fout << "\n";
-    // subárbol derecho
-    guardarInOrderAVL(nodo->derecho, fout);
-}
-
-
-static void guardarInOrderABB(NodoABB_Instructores* nodo, std::ofstream& fout) {
+
+static void guardarInOrderABB(NodoABB_Instructores* nodo, EscritorAtomico& salida) {
     if (!nodo) return;
     // recorre subárbol izquierdo
-    guardarInOrderABB(nodo->izquierdo, fout);
+    guardarInOrderABB(nodo->izquierdo, salida);
     // vuelca los datos del instructor
     Instructor* instr = nodo->instructor;
-    fout << instr->getId() << ","
-         << instr->getNombreCompleto() << ","
-         << instr->getAnioIngreso() << ","
-         << instr->getSueldoBase() << ","
-         << instr->getTipoBaile() << "\n";
+    salida.escribirEntero(instr->getId());
+    salida.escribir(',');
+    salida.escribir(instr->getNombreCompleto());
+    salida.escribir(',');
+    salida.escribirEntero(instr->getAnioIngreso());
+    salida.escribir(',');
+    salida.escribirReal(instr->getSueldoBase());
+    salida.escribir(',');
+    salida.escribir(instr->getTipoBaile());
+    salida.escribir('\n');
     // recorre subárbol derecho
-    guardarInOrderABB(nodo->derecho, fout);
+    guardarInOrderABB(nodo->derecho, salida);
 }
 /**
- * @brief Guarda los datos en los archivos correspondientes.
+ * @brief Exporta los datos a los archivos CSV correspondientes.
  *
- * Este método crea y cierra los archivos "instructores.csv" y "estudiantes.csv".
- * Si los archivos no existen, el método los genera vacíos.
+ * Cada archivo se escribe en un temporal con un búfer propio y reemplaza al anterior
+ * solo cuando está completo y sincronizado a disco, de modo que una interrupción
+ * nunca deja un CSV a medio escribir.
  */
-void Sistema::guardarDatos() {
+void Sistema::exportarCSV() {
+    EscritorAtomico salida;
+    std::string error;
+
     // Guardar instructores
-    std::ofstream fileIns("D:/Taller3/instructores.csv");
-    if (!fileIns) {
+    if (!salida.abrir(rutaDatos("instructores.csv"))) {
         std::cerr << "Error al abrir instructores.csv para escritura\n";
     } else {
-        guardarInOrderABB(raizABB, fileIns);
-        fileIns.close();
+        guardarInOrderABB(raizABB, salida);
+        if (!salida.confirmar(error)) std::cerr << "Error al guardar instructores.csv: " << error << "\n";
     }
 
     // Guardar estudiantes
-    std::ofstream fileEst("D:/Taller3/estudiantes.csv");
-    if (!fileEst) {
+    if (!salida.abrir(rutaDatos("estudiantes.csv"))) {
         std::cerr << "Error al abrir estudiantes.csv para escritura\n";
     } else {
-        guardarInOrderAVL(raizAVL, fileEst);
-        fileEst.close();
+        guardarEstudiantesCSV(estudiantes(), salida);
+        if (!salida.confirmar(error)) std::cerr << "Error al guardar estudiantes.csv: " << error << "\n";
+    }
+}
+
+// Registros mínimos de bitácora antes de compactar; evita reescribir el snapshot por pocos cambios
+static const size_t UMBRAL_MINIMO_COMPACTACION = 1024;
+
+/**
+ * @brief Guarda el estado del sistema al salir.
+ *
+ * Cada cambio ya quedó en la bitácora al hacerse, así que el snapshot solo se reescribe
+ * si la bitácora creció lo suficiente. Los CSV quedan como formato de importación y
+ * exportación (ver exportarCSV()).
+ */
+void Sistema::guardarDatos() {
+    compactarSiCorresponde();
+}
+
+/**
+ * @brief Calcula cuántos registros de bitácora justifican reescribir el snapshot.
+ *
+ * Con un umbral proporcional a la cantidad de estudiantes, el costo lineal de la
+ * compactación se reparte en O(1) por cambio registrado.
+ *
+ * @return Número de registros a partir del cual se compacta.
+ */
+size_t Sistema::umbralCompactacion() const {
+    return std::max(UMBRAL_MINIMO_COMPACTACION, indiceEstudiantes.getCantidad() / 4);
+}
+
+/**
+ * @brief Compacta la bitácora cuando alcanza el umbral.
+ */
+void Sistema::compactarSiCorresponde() {
+    if (bitacora.getNumRegistros() >= umbralCompactacion()) {
+        compactar();
+    }
+}
+
+/**
+ * @brief Incorpora la bitácora a un snapshot nuevo y la vacía.
+ *
+ * El snapshot se escribe primero: si el proceso se interrumpe antes de vaciar la
+ * bitácora, al reproducirla sobre el snapshot nuevo sus cambios no tienen efecto.
+ *
+ * @return true si la compactación se completó.
+ */
+bool Sistema::compactar() {
+    if (!guardarSnapshot()) return false;
+    return bitacora.vaciar();
+}
+
+/**
+ * @brief Escribe el snapshot binario de ambos árboles en el directorio de datos.
+ *
+ * @return true si el snapshot se escribió correctamente.
+ */
+bool Sistema::guardarSnapshot() {
+    std::string error;
+    if (!Snapshot::guardar(rutaDatos("sistema.snap"), raizABB, raizAVL, error)) {
+        std::cerr << "Error al guardar sistema.snap: " << error << "\n";
+        return false;
     }
+    return true;
 }
 
 /**
@@ -92,7 +199,7 @@ void Sistema::guardarDatos() {
  *
  * Este método presenta un menú interactivo con diversas opciones relacionadas con la gestión
  * del sistema, como matricular estudiantes, calcular pagos, mostrar estudiantes, obtener un
- * instructor por ID, y eliminar un instructor. La interacción continúa hasta que el usuario
+ * instructor por ID, eliminar un instructor, exportar los datos a CSV y exportar los pagos a un archivo. La interacción continúa hasta que el usuario
  * selecciona la opción para salir.
  *
  */
@@ -105,7 +212,13 @@ void Sistema::mostrarMenu() {
         std::cout << "3. Mostrar Estudiantes\n";
         std::cout << "4. Obtener Instructor por ID\n";
         std::cout << "5. Eliminar Instructor\n";
-        std::cout << "6. Salir\n";
+        std::cout << "6. Exportar datos a CSV\n";
+        std::cout << "7. Exportar pagos a archivo\n";
+        std::cout << "8. Estudiantes matriculados entre dos fechas\n";
+        std::cout << "9. Estadisticas de matricula\n";
+        std::cout << "10. Eliminar Estudiante\n";
+        std::cout << "11. Buscar por nombre\n";
+        std::cout << "12. Salir\n";
         std::cout << "Seleccione una opcion: ";
         std::cin >> opcion;
         std::cin.ignore();
@@ -116,10 +229,28 @@ void Sistema::mostrarMenu() {
             case 3: mostrarEstudiantes(); break;
             case 4: obtenerInstructor(); break;
             case 5: eliminarInstructor(); break;
-            case 6: std::cout << "Saliendo...\n"; break;
+            case 6: exportarCSV(); std::cout << "Datos exportados a CSV.\n"; break;
+            case 7: {
+                std::string ruta, formato;
+                std::cout << "Archivo de destino: ";
+                std::getline(std::cin, ruta);
+                std::cout << "Formato (csv/json): ";
+                std::getline(std::cin, formato);
+                if (formato != "csv" && formato != "json") {
+                    std::cout << "Formato invalido.\n";
+                } else if (exportarPagos(ruta, formato == "csv" ? FormatoPagos::CSV : FormatoPagos::JSONL)) {
+                    std::cout << "Pagos exportados a " << ruta << ".\n";
+                }
+                break;
+            }
+            case 8: mostrarEstudiantesEntre(); break;
+            case 9: mostrarEstadisticasMatricula(); break;
+            case 10: eliminarEstudiante(); break;
+            case 11: buscarPorNombre(); break;
+            case 12: std::cout << "Saliendo...\n"; break;
             default: std::cout << "Opcion invalida.\n"; break;
         }
-    } while (opcion != 6);
+    } while (opcion != 12);
 }
 
 /**
@@ -127,73 +258,144 @@ void Sistema::mostrarMenu() {
  *        cotización AFP y sueldo líquido, basado en la popularidad del tipo de baile
  *        entre los estudiantes y la antigüedad del instructor.
  *
- * Este método analiza las preferencias de los estudiantes almacenadas en un árbol AVL
- * para determinar el tipo de baile más popular. Posteriormente, utiliza esta información
+ * El tipo de baile más popular se obtiene de los contadores por estilo que el sistema
+ * mantiene al día, sin recorrer el árbol AVL. Posteriormente, utiliza esta información
  * para calcular los pagos de los instructores registrados en un árbol ABB.
  *
  * La información procesada incluye:
- * - Recuento de preferencias de los estudiantes por tipo de baile.
  * - Identificación del tipo de baile más popular.
  * - Cálculo del sueldo bruto, cotización AFP y sueldo líquido de cada instructor
  *   en base al año actual, el tipo de baile que enseñan y la popularidad de dicho tipo.
  *
- * El método recorre completamente el árbol AVL para contar las preferencias, y el árbol ABB
- * para calcular y mostrar los datos financieros de cada instructor.
+ * Los datos de los instructores se copian a arreglos contiguos y se calculan en bloque
+ * con MotorPagos; la salida se formatea después del cálculo. El costo no depende de la
+ * cantidad de estudiantes.
  *
  */
 void Sistema::calcularPagos() {
-    // 1. Inicializar contadores por tipo de baile
-    const char* tipos[] = { "Bachata", "Reggaeton", "Salsa", "Cumbia", "Tango" };
-    int conteo[5] = { 0 };
-
-    // 2. Contar preferencias recorriendo AVL
-    std::function<void(NodoAVL_Estudiantes*)> contar = [&](NodoAVL_Estudiantes* nodo) {
-        if (!nodo) return;
-        contar(nodo->izquierdo);
-        for (int i = 0; i < nodo->estudiante->getNumPreferencias(); ++i) {
-            std::string pref = nodo->estudiante->getPreferencia(i);
-            for (int j = 0; j < 5; ++j) {
-                if (pref == tipos[j]) {
-                    conteo[j]++;
-                    break;
-                }
-            }
-        }
-        contar(nodo->derecho);
-    };
-    contar(raizAVL);
+    // 1. Calcular los pagos de todos los instructores en bloque
+    MotorPagos motor;
+    calcularMotorPagos(motor);
 
-    // 3. Determinar tipo más popular
-    int maxIndex = 0;
-    for (int i = 1; i < 5; ++i) {
-        if (conteo[i] > conteo[maxIndex]) {
-            maxIndex = i;
-        }
+    // 2. Mostrar pagos para cada instructor, formateados al final y escritos de una vez
+    std::ostringstream salida;
+    for (size_t i = 0; i < motor.getCantidad(); ++i) {
+        salida << "\nInstructor: " << motor.getInstructor(i)->getNombreCompleto() << "\n";
+        salida << "Sueldo Bruto: $" << motor.getSueldoBruto(i) << "\n";
+        salida << "AFP: $" << motor.getCotizacionAFP(i) << "\n";
+        salida << "Sueldo Liquido: $" << motor.getSueldoLiquido(i) << "\n";
     }
-    const char* tipoPopular = tipos[maxIndex];
+    std::cout << salida.str();
+}
 
-    // 4. Mostrar pagos para cada instructor
+/**
+ * @brief Prepara un MotorPagos con los instructores actuales y calcula sus pagos.
+ *
+ * El tipo más popular se toma de los contadores mantenidos al matricular, cargar y
+ * eliminar estudiantes; la antigüedad se mide respecto del año en curso.
+ *
+ * @param motor Motor que recibe los datos y los resultados.
+ */
+void Sistema::calcularMotorPagos(MotorPagos& motor) const {
+    calcularMotorPagos(motor, getEstiloMasPopular());
+}
+
+/**
+ * @brief Calcula los pagos con un estilo más popular ya conocido, por ejemplo el de una versión
+ *        de la vista persistente.
+ *
+ * @param motor Motor que recibe los datos y los resultados.
+ * @param estiloPopular Estilo que recibe el bono de popularidad.
+ */
+void Sistema::calcularMotorPagos(MotorPagos& motor, EstiloBaile estiloPopular) const {
+    // localtime() comparte un resultado estático; esta consulta puede correr en varios hilos a la vez
     time_t t = time(nullptr);
-    tm* tiempo = localtime(&t);
-    int anioActual = 1900 + tiempo->tm_year;
+    tm tiempo;
+#ifdef _WIN32
+    localtime_s(&tiempo, &t);
+#else
+    localtime_r(&t, &tiempo);
+#endif
+    int anioActual = 1900 + tiempo.tm_year;
 
-    std::function<void(NodoABB_Instructores*)> recorrer = [&](NodoABB_Instructores* nodo) {
-        if (!nodo) return;
-        recorrer(nodo->izquierdo);
+    motor.cargar(raizABB);
+    motor.calcular(anioActual, estiloPopular);
+}
 
-        bool esPopular = nodo->instructor->getTipoBaile() == tipoPopular;
-        double bruto = nodo->instructor->calcularSueldoBruto(anioActual, esPopular);
-        double afp = nodo->instructor->calcularCotizacionAFP(bruto);
-        double liquido = nodo->instructor->calcularSueldoLiquido(bruto);
+/**
+ * @brief Calcula los pagos y los exporta a un archivo CSV o JSON por líneas.
+ *
+ * @param ruta Archivo de destino.
+ * @param formato Formato del informe.
+ * @return true si el informe se escribió.
+ */
+bool Sistema::exportarPagos(const std::string& ruta, FormatoPagos formato) {
+    MotorPagos motor;
+    calcularMotorPagos(motor);
+    std::string error;
+    if (!motor.exportar(ruta, formato, error)) {
+        std::cerr << "Error al exportar pagos: " << error << "\n";
+        return false;
+    }
+    return true;
+}
 
-        std::cout << "\nInstructor: " << nodo->instructor->getNombreCompleto() << "\n";
-        std::cout << "Sueldo Bruto: $" << bruto << "\n";
-        std::cout << "AFP: $" << afp << "\n";
-        std::cout << "Sueldo Liquido: $" << liquido << "\n";
+/**
+ * @brief Suma al contador de cada estilo las preferencias de un estudiante.
+ *
+ * @param est Estudiante recién insertado.
+ */
+void Sistema::sumarPreferencias(const Estudiante* est) {
+    const unsigned mascara = est->getMascaraPreferencias();
+    for (int j = 0; j < NUM_ESTILOS_BAILE; ++j) {
+        conteoEstilos[j] += (mascara >> j) & 1u;
+    }
+}
 
-        recorrer(nodo->derecho);
-    };
-    recorrer(raizABB);
+/**
+ * @brief Resta del contador de cada estilo las preferencias de un estudiante.
+ *
+ * @param est Estudiante que se elimina.
+ */
+void Sistema::restarPreferencias(const Estudiante* est) {
+    const unsigned mascara = est->getMascaraPreferencias();
+    for (int j = 0; j < NUM_ESTILOS_BAILE; ++j) {
+        conteoEstilos[j] -= (mascara >> j) & 1u;
+    }
+}
+
+/**
+ * @brief Cantidad de estudiantes que prefieren un estilo.
+ *
+ * @param estilo Estilo consultado.
+ * @return Valor del contador del estilo.
+ */
+size_t Sistema::getConteoEstilo(EstiloBaile estilo) const {
+    return conteoEstilos[(unsigned)estilo];
+}
+
+/**
+ * @brief Estilo con más preferencias; los empates se resuelven por el orden de EstiloBaile.
+ *
+ * @return El primer estilo con el conteo máximo.
+ */
+EstiloBaile Sistema::getEstiloMasPopular() const {
+    return estiloMasPopular(conteoEstilos);
+}
+
+/**
+ * @brief Máscara de todos los estilos que comparten el conteo máximo.
+ *
+ * @return Máscara de estilos empatados, o 0 si todos los contadores están en cero.
+ */
+uint8_t Sistema::getMascaraEstilosMasPopulares() const {
+    const size_t conteoMaximo = conteoEstilos[(unsigned)getEstiloMasPopular()];
+    if (conteoMaximo == 0) return 0;
+    uint8_t mascara = 0;
+    for (int i = 0; i < NUM_ESTILOS_BAILE; ++i) {
+        if (conteoEstilos[i] == conteoMaximo) mascara |= bitEstilo((EstiloBaile)i);
+    }
+    return mascara;
 }
 
 /**
@@ -202,35 +404,100 @@ void Sistema::calcularPagos() {
  * Este método realiza un recorrido en inorden sobre el árbol AVL de estudiantes,
  * permitiendo procesar los nodos en orden ascendente según las claves del árbol.
  * Durante el recorrido, imprime en la consola los detalles de cada estudiante:
- * identificador, nombre, fecha y preferencias.
+ * identificador, nombre, fecha y preferencias. Si la vista persistente está activa se
+ * recorre una versión fija de ella, que no cambia aunque otro hilo matricule mientras tanto.
  */
 void Sistema::mostrarEstudiantes() {
-    if (!raizAVL) {
+    std::shared_ptr<const VersionEstudiantes> version = instantaneaEstudiantes();
+    if (version ? version->getCantidad() == 0 : !raizAVL) {
         std::cout << "No hay estudiantes registrados.\n";
         return;
     }
-    NodoAVL_Estudiantes* stack[100];
-    int top = -1;
-    NodoAVL_Estudiantes* curr = raizAVL;
-    while (curr || top >= 0) {
-        while (curr) {
-            stack[++top] = curr;
-            curr = curr->izquierdo;
-        }
-        curr = stack[top--];
-        Estudiante* e = curr->estudiante;
-        std::cout << "ID: " << e->getId()
-                  << "  Nombre: " << e->getNombre()
-                  << "  Fecha: " << e->getDia() << "/" << e->getMes() << "/" << e->getAnio()
-                  << "  Hora: " << e->getHora() << ":" << (e->getMinuto() < 10 ? "0" : "") << e->getMinuto()
+    auto mostrar = [](const Estudiante& e) {
+        std::cout << "ID: " << e.getId()
+                  << "  Nombre: " << e.getNombre()
+                  << "  Fecha: " << e.getDia() << "/" << e.getMes() << "/" << e.getAnio()
+                  << "  Hora: " << e.getHora() << ":" << (e.getMinuto() < 10 ? "0" : "") << e.getMinuto()
                   << "  Prefs: ";
-        for (int i = 0; i < e->getNumPreferencias(); ++i) {
-            std::cout << e->getPreferencia(i);
-            if (i < e->getNumPreferencias() - 1) std::cout << "|";
+        for (int i = 0; i < e.getNumPreferencias(); ++i) {
+            std::cout << e.getPreferencia(i);
+            if (i < e.getNumPreferencias() - 1) std::cout << "|";
         }
         std::cout << "\n";
-        curr = curr->derecho;
+    };
+    if (version) {
+        version->recorrer(mostrar);
+    } else {
+        for (const Estudiante& e : estudiantes()) mostrar(e);
+    }
+}
+
+/**
+ * @brief Construye el rango con todos los estudiantes del AVL actual.
+ */
+RangoEstudiantes Sistema::estudiantes() const {
+    return RangoEstudiantes(raizAVL);
+}
+
+/**
+ * @brief Construye el rango de estudiantes entre dos instantes sobre el AVL actual.
+ */
+RangoEstudiantes Sistema::estudiantesEntre(const FechaHora& desde, const FechaHora& hasta,
+                                           uint8_t mascaraPreferencias) const {
+    return RangoEstudiantes(raizAVL, RangoEstudiantes::claveDesde(desde), RangoEstudiantes::claveHasta(hasta),
+                            mascaraPreferencias);
+}
+
+/**
+ * @brief Lista los estudiantes matriculados entre dos fechas, opcionalmente filtrados por estilo.
+ *
+ * Las fechas se ingresan con el mismo formato del CSV ("MM/DD/YYYY HH:MM"). El listado se
+ * arma en memoria y se escribe de una sola vez.
+ */
+void Sistema::mostrarEstudiantesEntre() {
+    std::string texto;
+    FechaHora desde, hasta;
+    std::cout << "Desde (MM/DD/YYYY HH:MM): ";
+    std::getline(std::cin, texto);
+    if (!LectorCSV::parsearFecha(texto, desde.dia, desde.mes, desde.anio, desde.hora, desde.minuto)) {
+        std::cout << "Error: fecha invalida.\n";
+        return;
+    }
+    std::cout << "Hasta (MM/DD/YYYY HH:MM): ";
+    std::getline(std::cin, texto);
+    if (!LectorCSV::parsearFecha(texto, hasta.dia, hasta.mes, hasta.anio, hasta.hora, hasta.minuto)) {
+        std::cout << "Error: fecha invalida.\n";
+        return;
+    }
+    std::cout << "Estilo (vacio para todos): ";
+    std::getline(std::cin, texto);
+    uint8_t mascara = 0;
+    if (!texto.empty()) {
+        EstiloBaile estilo;
+        if (!estiloDesdeTexto(texto, estilo)) {
+            std::cout << "Error: estilo desconocido.\n";
+            return;
+        }
+        mascara = bitEstilo(estilo);
     }
+
+    std::ostringstream salida;
+    size_t total = 0;
+    for (const Estudiante& e : estudiantesEntre(desde, hasta, mascara)) {
+        salida << "ID: " << e.getId()
+               << "  Nombre: " << e.getNombre()
+               << "  Fecha: " << e.getDia() << "/" << e.getMes() << "/" << e.getAnio()
+               << "  Hora: " << e.getHora() << ":" << (e.getMinuto() < 10 ? "0" : "") << e.getMinuto()
+               << "  Prefs: ";
+        for (int i = 0; i < e.getNumPreferencias(); ++i) {
+            salida << e.getPreferencia(i);
+            if (i < e.getNumPreferencias() - 1) salida << "|";
+        }
+        salida << "\n";
+        ++total;
+    }
+    salida << total << " estudiante(s) en el periodo.\n";
+    std::cout << salida.str();
 }
 
 /**
@@ -273,14 +540,79 @@ void Sistema::obtenerInstructor() {
 }
 
 
+// Altura de un nodo del ABB de instructores
+int altura(NodoABB_Instructores* nodo) {
+    return nodo ? nodo->altura : 0;
+}
+
+// Recalcula la altura de un nodo del ABB a partir de sus hijos
+static void actualizarAltura(NodoABB_Instructores* nodo) {
+    int izq = altura(nodo->izquierdo);
+    int der = altura(nodo->derecho);
+    nodo->altura = (izq > der ? izq : der) + 1;
+}
+
+// Rotación simple derecha en el ABB de instructores
+NodoABB_Instructores* rotarDerecha(NodoABB_Instructores* y) {
+    NodoABB_Instructores* x = y->izquierdo;
+    y->izquierdo = x->derecho;
+    x->derecho = y;
+    actualizarAltura(y);
+    actualizarAltura(x);
+    return x;
+}
+
+// Rotación simple izquierda en el ABB de instructores
+NodoABB_Instructores* rotarIzquierda(NodoABB_Instructores* x) {
+    NodoABB_Instructores* y = x->derecho;
+    x->derecho = y->izquierdo;
+    y->izquierdo = x;
+    actualizarAltura(x);
+    actualizarAltura(y);
+    return y;
+}
+
+// Factor de equilibrio de un nodo del ABB de instructores
+int obtenerBalance(NodoABB_Instructores* nodo) {
+    return nodo ? altura(nodo->izquierdo) - altura(nodo->derecho) : 0;
+}
+
+/**
+ * @brief Restablece el equilibrio AVL de un nodo del ABB de instructores.
+ *
+ * Actualiza la altura del nodo y, si su factor de equilibrio sale del rango [-1, 1],
+ * aplica la rotación simple o doble que corresponda según el balance del hijo más alto.
+ * Sirve tanto después de insertar como después de eliminar.
+ *
+ * @param nodo Raíz del subárbol a equilibrar.
+ * @return La nueva raíz del subárbol.
+ */
+static NodoABB_Instructores* balancearABB(NodoABB_Instructores* nodo) {
+    actualizarAltura(nodo);
+    int balance = obtenerBalance(nodo);
+
+    if (balance > 1) {
+        if (obtenerBalance(nodo->izquierdo) < 0)
+            nodo->izquierdo = rotarIzquierda(nodo->izquierdo);
+        return rotarDerecha(nodo);
+    }
+    if (balance < -1) {
+        if (obtenerBalance(nodo->derecho) > 0)
+            nodo->derecho = rotarDerecha(nodo->derecho);
+        return rotarIzquierda(nodo);
+    }
+    return nodo;
+}
+
 /**
  * @brief Elimina un nodo específico del Árbol Binario de Búsqueda (ABB) de instructores
- *        identificado por un ID, manteniendo la estructura del ABB.
+ *        identificado por un ID, manteniendo la estructura y el equilibrio del ABB.
  *
  * Este método busca y elimina el nodo correspondiente al ID proporcionado del ABB.
  * Si el nodo no tiene hijos, se elimina directamente. Si tiene un único subárbol,
  * se reemplaza por dicho subárbol. Para nodos con dos hijos, se reemplaza por su sucesor
- * en orden, manteniendo las propiedades del ABB.
+ * en orden, manteniendo las propiedades del ABB. Al volver de la recursión se
+ * reequilibra cada nodo del camino, por lo que la altura se mantiene en O(log n).
  *
  * @param raiz Puntero al nodo raíz del árbol o subárbol actual.
  *             Representa el punto de inicio para la búsqueda y eliminación del nodo.
@@ -297,24 +629,17 @@ NodoABB_Instructores* eliminarNodoABB(NodoABB_Instructores* raiz, int id) {
     } else if (id > raiz->instructor->getId()) {
         raiz->derecho = eliminarNodoABB(raiz->derecho, id);
     } else {
-        if (!raiz->izquierdo) {
-            auto* temp = raiz->derecho;
-            delete raiz->instructor;
-            delete raiz;
+        if (!raiz->izquierdo || !raiz->derecho) {
+            NodoABB_Instructores* temp = raiz->izquierdo ? raiz->izquierdo : raiz->derecho;
+            delete raiz; // el destructor del nodo libera al instructor
             return temp;
-        } else if (!raiz->derecho) {
-            auto* temp = raiz->izquierdo;
-            delete raiz->instructor;
-            delete raiz;
-            return temp;
-        } else {
-            NodoABB_Instructores* sucesor = raiz->derecho;
-            while (sucesor->izquierdo) sucesor = sucesor->izquierdo;
-            std::swap(raiz->instructor, sucesor->instructor);
-            raiz->derecho = eliminarNodoABB(raiz->derecho, sucesor->instructor->getId());
         }
+        NodoABB_Instructores* sucesor = raiz->derecho;
+        while (sucesor->izquierdo) sucesor = sucesor->izquierdo;
+        std::swap(raiz->instructor, sucesor->instructor);
+        raiz->derecho = eliminarNodoABB(raiz->derecho, sucesor->instructor->getId());
     }
-    return raiz;
+    return balancearABB(raiz);
 }
 
 /**
@@ -329,186 +654,1079 @@ void Sistema::eliminarInstructor() {
     std::cout << "Ingrese ID del instructor a eliminar: ";
     std::cin >> id;
 
-    if (!idExiste(id, false)) {
-        std::cout << "Instructor no encontrado.\n";
+    std::string error;
+    if (!eliminarInstructor(id, &error)) {
+        std::cout << "Error: " << error << ".\n";
         return;
     }
-
-    raizABB = eliminarNodoABB(raizABB, id);
     std::cout << "Instructor eliminado exitosamente.\n";
 }
 
 /**
- * @brief Verifica si un identificador ya existe en el sistema.
+ * @brief Elimina un instructor por ID después de registrar el cambio en la bitácora.
  *
- * @param id El identificador que se desea verificar.
- * @param esEstudiante Un valor booleano que indica si el identificador pertenece a un estudiante.
- * @return true si el identificador existe en el sistema, false en caso contrario.
+ * @param id ID del instructor a eliminar.
+ * @param error Si no es nullptr, recibe la causa cuando no se elimina.
+ * @return true si el instructor existía y el cambio quedó registrado.
  */
-bool Sistema::idExiste(int id, bool esEstudiante) {
-    if (esEstudiante) {
-        std::function<bool(NodoAVL_Estudiantes*)> buscar = [&](NodoAVL_Estudiantes* nodo) {
-            if (!nodo) return false;
-            if (nodo->estudiante->getId() == id) return true;
-            return buscar(nodo->izquierdo) || buscar(nodo->derecho);
-        };
-        return buscar(raizAVL);
-    } else {
-        NodoABB_Instructores* actual = raizABB;
-        while (actual) {
-            if (id == actual->instructor->getId()) return true;
-            actual = id < actual->instructor->getId() ? actual->izquierdo : actual->derecho;
-        }
+bool Sistema::eliminarInstructor(int id, std::string* error) {
+    if (!idExiste(id, false)) {
+        if (error) *error = "instructor no encontrado";
+        return false;
+    }
+    if (!bitacora.registrarEliminacionInstructor(id)) {
+        if (error) *error = "no se pudo registrar el cambio";
         return false;
     }
-}
-// Inserta un nodo en el ABB de instructores
-NodoABB_Instructores* insertarEnABB(NodoABB_Instructores* raiz, Instructor* instr) {
-    if (!raiz) return new NodoABB_Instructores(instr);
 
-    if (instr->getId() < raiz->instructor->getId())
-        raiz->izquierdo = insertarEnABB(raiz->izquierdo, instr);
-    else if (instr->getId() > raiz->instructor->getId())
-        raiz->derecho = insertarEnABB(raiz->derecho, instr);
-    return raiz;
+    eliminarNodoInstructor(id);
+    compactarSiCorresponde();
+    return true;
 }
 
-// Altura del nodo
-int altura(NodoAVL_Estudiantes* nodo) {
-    return nodo ? nodo->altura : 0;
-}
+/**
+ * @brief Solicita el ID de un estudiante y lo da de baja del sistema.
+ */
+void Sistema::eliminarEstudiante() {
+    int id;
+    std::cout << "Ingrese ID del estudiante a eliminar: ";
+    std::cin >> id;
 
-// Máximo entre dos enteros
-int maximo(int a, int b) {
-    return (a > b) ? a : b;
+    std::string error;
+    if (!eliminarEstudiante(id, &error)) {
+        std::cout << "Error: " << error << ".\n";
+        return;
+    }
+    std::cout << "Estudiante eliminado exitosamente.\n";
 }
 
-// Rotación simple derecha
-NodoAVL_Estudiantes* rotarDerecha(NodoAVL_Estudiantes* y) {
-    NodoAVL_Estudiantes* x = y->izquierdo;
-    NodoAVL_Estudiantes* T2 = x->derecho;
-    x->derecho = y;
-    y->izquierdo = T2;
-    y->altura = maximo(altura(y->izquierdo), altura(y->derecho)) + 1;
-    x->altura = maximo(altura(x->izquierdo), altura(x->derecho)) + 1;
-    return x;
-}
+/**
+ * @brief Elimina un estudiante por ID después de registrar el cambio en la bitácora.
+ *
+ * El nodo se ubica con el índice hash y se desenlaza del AVL por su clave.
+ *
+ * @param id ID del estudiante a eliminar.
+ * @param error Si no es nullptr, recibe la causa cuando no se elimina.
+ * @return true si el estudiante existía y el cambio quedó registrado.
+ */
+bool Sistema::eliminarEstudiante(int id, std::string* error) {
+    NodoAVL_Estudiantes* nodo = indiceEstudiantes.buscar(id);
+    if (!nodo) {
+        if (error) *error = "estudiante no encontrado";
+        return false;
+    }
+    if (!bitacora.registrarEliminacionEstudiante(id)) {
+        if (error) *error = "no se pudo registrar el cambio";
+        return false;
+    }
 
-// Rotación simple izquierda
-NodoAVL_Estudiantes* rotarIzquierda(NodoAVL_Estudiantes* x) {
-    NodoAVL_Estudiantes* y = x->derecho;
-    NodoAVL_Estudiantes* T2 = y->izquierdo;
-    y->izquierdo = x;
-    x->derecho = T2;
-    x->altura = maximo(altura(x->izquierdo), altura(x->derecho)) + 1;
-    y->altura = maximo(altura(y->izquierdo), altura(y->derecho)) + 1;
-    return y;
+    eliminarNodoEstudiante(nodo);
+    compactarSiCorresponde();
+    return true;
 }
 
-// Factor de equilibrio
-int obtenerBalance(NodoAVL_Estudiantes* nodo) {
-    return nodo ? altura(nodo->izquierdo) - altura(nodo->derecho) : 0;
+/**
+ * @brief Elimina un estudiante por fecha de matrícula e ID, comprobando que ambos coincidan.
+ *
+ * @param fecha Fecha y hora de matrícula.
+ * @param id ID del estudiante a eliminar.
+ * @return true si el estudiante existía con esa fecha.
+ */
+bool Sistema::eliminarEstudiante(const FechaHora& fecha, int id) {
+    NodoAVL_Estudiantes* nodo = indiceEstudiantes.buscar(id);
+    if (!nodo || nodo->clave != NodoAVL_Estudiantes::generarClave(fecha.anio, fecha.mes, fecha.dia,
+                                                                  fecha.hora, fecha.minuto, id)) {
+        return false;
+    }
+    return eliminarEstudiante(id);
 }
 
-// Inserta un nodo en el AVL de estudiantes
-NodoAVL_Estudiantes* insertarEnAVL(NodoAVL_Estudiantes* nodo, Estudiante* est) {
-    if (!nodo) return new NodoAVL_Estudiantes(est);
-
-    if (est->getFechaMatricula() < nodo->claveFecha)
-        nodo->izquierdo = insertarEnAVL(nodo->izquierdo, est);
-    else if (est->getFechaMatricula() > nodo->claveFecha)
-        nodo->derecho = insertarEnAVL(nodo->derecho, est);
-    else
-        return nodo;
-
-    nodo->altura = 1 + maximo(altura(nodo->izquierdo), altura(nodo->derecho));
-
-    int balance = obtenerBalance(nodo);
+/**
+ * @brief Quita el nombre del instructor del índice (si está construido) y lo elimina del ABB.
+ *
+ * @param id ID de un instructor existente.
+ */
+void Sistema::eliminarNodoInstructor(int id) {
+    if (indiceNombresListo) {
+        const Instructor* instr = buscarInstructorPorId(id);
+        if (instr) indiceNombres.quitar(instr->getNombreCompleto(), false, id);
+    }
+    raizABB = eliminarNodoABB(raizABB, id);
+}
 
-    // Rotaciones
-    if (balance > 1 && est->getFechaMatricula() < nodo->izquierdo->claveFecha)
-        return rotarDerecha(nodo);
-    if (balance < -1 && est->getFechaMatricula() > nodo->derecho->claveFecha)
-        return rotarIzquierda(nodo);
-    if (balance > 1 && est->getFechaMatricula() > nodo->izquierdo->claveFecha) {
-        nodo->izquierdo = rotarIzquierda(nodo->izquierdo);
-        return rotarDerecha(nodo);
+/**
+ * @brief Registra en el índice de nombres a todos los estudiantes e instructores.
+ */
+void Sistema::prepararIndiceNombres() {
+    if (indiceNombresListo) return;
+    indiceNombres.limpiar();
+    for (const Estudiante& e : estudiantes()) {
+        indiceNombres.agregar(e.getNombre(), true, e.getId());
     }
-    if (balance < -1 && est->getFechaMatricula() < nodo->derecho->claveFecha) {
-        nodo->derecho = rotarDerecha(nodo->derecho);
-        return rotarIzquierda(nodo);
+    // Instructores en preorden iterativo; el orden no importa
+    std::vector<NodoABB_Instructores*> pendientes;
+    if (raizABB) pendientes.push_back(raizABB);
+    while (!pendientes.empty()) {
+        NodoABB_Instructores* nodo = pendientes.back();
+        pendientes.pop_back();
+        indiceNombres.agregar(nodo->instructor->getNombreCompleto(), false, nodo->instructor->getId());
+        if (nodo->izquierdo) pendientes.push_back(nodo->izquierdo);
+        if (nodo->derecho) pendientes.push_back(nodo->derecho);
     }
-
-    return nodo;
+    indiceNombresListo = true;
 }
 
 /**
- * @brief Carga los datos de instructores y estudiantes desde archivos CSV específicos.
- *
- * Este método lee datos de los archivos "instructores.csv" y "estudiantes.csv",
- * creando instancias de las clases Instructor y Estudiante, respectivamente.
- * Procesa las líneas de cada archivo, extrayendo y parseando información como IDs, nombres,
- * fechas, preferencias y otros atributos relevantes para inicializar los objetos.
- *
- * Los datos de los instructores incluyen ID, nombre, año de ingreso, sueldo y tipo.
- * Los datos de los estudiantes incluyen ID, nombre, fecha y preferencias.
- * Maneja hasta tres preferencias por cada estudiante separadas por el carácter '|'.
- *
- * Los archivos son cerrados tras completar la lectura y procesamiento.
+ * @brief Busca personas en el índice de nombres, construyéndolo si hace falta.
  */
-void Sistema::cargarDatos() {
-    // Instructores
-    std::ifstream fileIns("D:/Taller3/instructores.csv");
-    if (!fileIns) {
+std::vector<PersonaNombre> Sistema::buscarPorNombre(const std::string& texto, BusquedaNombre modo) {
+    prepararIndiceNombres();
+    return indiceNombres.buscar(texto, modo);
+}
+
+/**
+ * @brief Busca personas en el índice de nombres, que ya debe estar construido.
+ */
+std::vector<PersonaNombre> Sistema::buscarPorNombre(const std::string& texto, BusquedaNombre modo) const {
+    if (!indiceNombresListo) {
+        std::cerr << "Indice de nombres sin preparar; llame a prepararIndiceNombres() antes de buscar\n";
+        return {};
+    }
+    return indiceNombres.buscar(texto, modo);
+}
+
+/**
+ * @brief Consulta el índice de nombres en busca de un estudiante con el mismo nombre.
+ */
+int Sistema::buscarEstudianteMismoNombre(const std::string& nombre) {
+    for (const PersonaNombre& p : buscarPorNombre(nombre, BusquedaNombre::Exacta)) {
+        if (p.esEstudiante) return p.id;
+    }
+    return -1;
+}
+
+/**
+ * @brief Busca por nombre completo, prefijo o apellido y muestra a los estudiantes e instructores encontrados.
+ */
+void Sistema::buscarPorNombre() {
+    std::string texto, modoTexto;
+    std::cout << "Texto a buscar: ";
+    std::getline(std::cin, texto);
+    std::cout << "Buscar por (1) nombre completo, (2) comienzo del nombre, (3) apellido: ";
+    std::getline(std::cin, modoTexto);
+    BusquedaNombre modo;
+    if (modoTexto == "1") modo = BusquedaNombre::Exacta;
+    else if (modoTexto == "2") modo = BusquedaNombre::Prefijo;
+    else if (modoTexto == "3") modo = BusquedaNombre::Apellido;
+    else {
+        std::cout << "Opcion invalida.\n";
+        return;
+    }
+
+    std::ostringstream salida;
+    std::vector<PersonaNombre> encontrados = buscarPorNombre(texto, modo);
+    for (const PersonaNombre& p : encontrados) {
+        if (p.esEstudiante) {
+            const Estudiante* e = buscarEstudiantePorId(p.id);
+            salida << "Estudiante  ID: " << p.id << "  Nombre: " << e->getNombre()
+                   << "  Fecha: " << e->getDia() << "/" << e->getMes() << "/" << e->getAnio() << "\n";
+        } else {
+            const Instructor* instr = buscarInstructorPorId(p.id);
+            salida << "Instructor  ID: " << p.id << "  Nombre: " << instr->getNombreCompleto()
+                   << "  Baile: " << instr->getTipoBaile() << "\n";
+        }
+    }
+    salida << encontrados.size() << " resultado(s).\n";
+    std::cout << salida.str();
+}
+
+/**
+ * @brief Genera un ID libre para un estudiante (al azar, en O(1)) o para un instructor.
+ *
+ * @param esEstudiante true para un ID de estudiante; false para uno de instructor.
+ * @return El ID, o -1 si el espacio de IDs está completo.
+ */
+int Sistema::generarIdUnico(bool esEstudiante) {
+    if (esEstudiante) {
+        int id;
+        return asignadorIds.asignar(id) ? id : -1;
+    }
+    for (int id = 1000; id <= 9999; id++) {
+        if (!idExiste(id, false)) return id;
+    }
+    return -1;
+}
+
+/**
+ * @brief Verifica si un identificador ya existe en el sistema.
+ *
+ * @param id El identificador que se desea verificar.
+ * @param esEstudiante Un valor booleano que indica si el identificador pertenece a un estudiante.
+ * @return true si el identificador existe en el sistema, false en caso contrario.
+ */
+bool Sistema::idExiste(int id, bool esEstudiante) {
+    if (esEstudiante) {
+        return indiceEstudiantes.buscar(id) != nullptr;
+    } else {
+        return buscarInstructorPorId(id) != nullptr;
+    }
+}
+
+/**
+ * @brief Busca un estudiante por ID usando el índice hash secundario.
+ *
+ * @param id El identificador del estudiante.
+ * @return Puntero al estudiante encontrado, o nullptr si no existe.
+ */
+Estudiante* Sistema::buscarEstudiantePorId(int id) const {
+    NodoAVL_Estudiantes* nodo = indiceEstudiantes.buscar(id);
+    return nodo ? nodo->estudiante : nullptr;
+}
+
+/**
+ * @brief Busca un instructor por ID descendiendo por el ABB.
+ *
+ * @param id El identificador del instructor.
+ * @return Puntero al instructor encontrado, o nullptr si no existe.
+ */
+const Instructor* Sistema::buscarInstructorPorId(int id) const {
+    return buscarEnABB(raizABB, id);
+}
+
+// Busca un instructor descendiendo por el ABB según su ID
+Instructor* buscarEnABB(NodoABB_Instructores* raiz, int id) {
+    while (raiz) {
+        if (id == raiz->instructor->getId()) return raiz->instructor;
+        raiz = id < raiz->instructor->getId() ? raiz->izquierdo : raiz->derecho;
+    }
+    return nullptr;
+}
+
+// Inserta un nodo en el ABB de instructores, reequilibrándolo como un AVL
+NodoABB_Instructores* insertarEnABB(NodoABB_Instructores* raiz, Instructor* instr) {
+    if (!raiz) return new NodoABB_Instructores(instr);
+
+    if (instr->getId() < raiz->instructor->getId())
+        raiz->izquierdo = insertarEnABB(raiz->izquierdo, instr);
+    else if (instr->getId() > raiz->instructor->getId())
+        raiz->derecho = insertarEnABB(raiz->derecho, instr);
+    else
+        return raiz;
+    return balancearABB(raiz);
+}
+
+// Altura del nodo
+int altura(NodoAVL_Estudiantes* nodo) {
+    return nodo ? nodo->altura : 0;
+}
+
+// Cantidad de nodos del subárbol
+int tamanio(NodoAVL_Estudiantes* nodo) {
+    return nodo ? nodo->tamanio : 0;
+}
+
+// Máximo entre dos enteros
+int maximo(int a, int b) {
+    return (a > b) ? a : b;
+}
+
+// Recalcula la altura y el tamaño de un nodo del AVL a partir de sus hijos
+void actualizarNodo(NodoAVL_Estudiantes* nodo) {
+    nodo->altura = maximo(altura(nodo->izquierdo), altura(nodo->derecho)) + 1;
+    nodo->tamanio = tamanio(nodo->izquierdo) + tamanio(nodo->derecho) + 1;
+}
+
+// Rotación simple derecha
+NodoAVL_Estudiantes* rotarDerecha(NodoAVL_Estudiantes* y) {
+    NodoAVL_Estudiantes* x = y->izquierdo;
+    NodoAVL_Estudiantes* T2 = x->derecho;
+    x->derecho = y;
+    y->izquierdo = T2;
+    actualizarNodo(y);
+    actualizarNodo(x);
+    return x;
+}
+
+// Rotación simple izquierda
+NodoAVL_Estudiantes* rotarIzquierda(NodoAVL_Estudiantes* x) {
+    NodoAVL_Estudiantes* y = x->derecho;
+    NodoAVL_Estudiantes* T2 = y->izquierdo;
+    y->izquierdo = x;
+    x->derecho = T2;
+    actualizarNodo(x);
+    actualizarNodo(y);
+    return y;
+}
+
+// Factor de equilibrio
+int obtenerBalance(NodoAVL_Estudiantes* nodo) {
+    return nodo ? altura(nodo->izquierdo) - altura(nodo->derecho) : 0;
+}
+
+// Inserta un nodo en el AVL de estudiantes, ordenado por su clave empaquetada.
+// Si la clave ya existe (mismo ID y misma fecha) el nodo no se enlaza e insertado queda en false.
+NodoAVL_Estudiantes* insertarEnAVL(NodoAVL_Estudiantes* nodo, NodoAVL_Estudiantes* nuevo, bool& insertado) {
+    if (!nodo) {
+        insertado = true;
+        return nuevo;
+    }
+
+    const uint64_t clave = nuevo->clave;
+    if (clave < nodo->clave)
+        nodo->izquierdo = insertarEnAVL(nodo->izquierdo, nuevo, insertado);
+    else if (clave > nodo->clave)
+        nodo->derecho = insertarEnAVL(nodo->derecho, nuevo, insertado);
+    else {
+        insertado = false;
+        return nodo;
+    }
+
+    actualizarNodo(nodo);
+
+    int balance = obtenerBalance(nodo);
+
+    // Rotaciones
+    if (balance > 1 && clave < nodo->izquierdo->clave)
+        return rotarDerecha(nodo);
+    if (balance < -1 && clave > nodo->derecho->clave)
+        return rotarIzquierda(nodo);
+    if (balance > 1 && clave > nodo->izquierdo->clave) {
+        nodo->izquierdo = rotarIzquierda(nodo->izquierdo);
+        return rotarDerecha(nodo);
+    }
+    if (balance < -1 && clave < nodo->derecho->clave) {
+        nodo->derecho = rotarDerecha(nodo->derecho);
+        return rotarIzquierda(nodo);
+    }
+
+    return nodo;
+}
+
+// Recalcula un nodo del AVL de estudiantes y lo reequilibra si hace falta.
+// A diferencia de la inserción, tras una eliminación el hijo alto puede estar equilibrado,
+// por lo que el caso doble se decide con el factor de equilibrio del hijo.
+NodoAVL_Estudiantes* balancearAVL(NodoAVL_Estudiantes* nodo) {
+    actualizarNodo(nodo);
+    int balance = obtenerBalance(nodo);
+
+    if (balance > 1) {
+        if (obtenerBalance(nodo->izquierdo) < 0)
+            nodo->izquierdo = rotarIzquierda(nodo->izquierdo);
+        return rotarDerecha(nodo);
+    }
+    if (balance < -1) {
+        if (obtenerBalance(nodo->derecho) > 0)
+            nodo->derecho = rotarDerecha(nodo->derecho);
+        return rotarIzquierda(nodo);
+    }
+    return nodo;
+}
+
+// Desenlaza el nodo de menor clave del subárbol, lo deja en minimo y devuelve la nueva raíz
+NodoAVL_Estudiantes* extraerMinimoAVL(NodoAVL_Estudiantes* nodo, NodoAVL_Estudiantes*& minimo) {
+    if (!nodo->izquierdo) {
+        minimo = nodo;
+        return nodo->derecho;
+    }
+    nodo->izquierdo = extraerMinimoAVL(nodo->izquierdo, minimo);
+    return balancearAVL(nodo);
+}
+
+/**
+ * @brief Desenlaza del AVL de estudiantes el nodo con la clave dada, reequilibrando el camino.
+ *
+ * Un nodo con dos hijos se reemplaza enlazando en su lugar al sucesor en orden, en vez de
+ * intercambiar los estudiantes: así cada estudiante conserva su nodo y el índice por ID
+ * sigue apuntando a nodos válidos. El costo es O(log n).
+ *
+ * @param nodo Raíz del subárbol.
+ * @param clave Clave empaquetada del estudiante a quitar.
+ * @param eliminado Recibe el nodo desenlazado, o nullptr si la clave no estaba.
+ * @return La nueva raíz del subárbol.
+ */
+NodoAVL_Estudiantes* eliminarDeAVL(NodoAVL_Estudiantes* nodo, uint64_t clave, NodoAVL_Estudiantes*& eliminado) {
+    if (!nodo) {
+        eliminado = nullptr;
+        return nullptr;
+    }
+
+    if (clave < nodo->clave) {
+        nodo->izquierdo = eliminarDeAVL(nodo->izquierdo, clave, eliminado);
+    } else if (clave > nodo->clave) {
+        nodo->derecho = eliminarDeAVL(nodo->derecho, clave, eliminado);
+    } else {
+        eliminado = nodo;
+        if (!nodo->izquierdo || !nodo->derecho) {
+            return nodo->izquierdo ? nodo->izquierdo : nodo->derecho;
+        }
+        NodoAVL_Estudiantes* sucesor = nullptr;
+        NodoAVL_Estudiantes* derecho = extraerMinimoAVL(nodo->derecho, sucesor);
+        sucesor->izquierdo = nodo->izquierdo;
+        sucesor->derecho = derecho;
+        nodo = sucesor;
+    }
+    if (!eliminado) return nodo;
+    return balancearAVL(nodo);
+}
+
+/**
+ * @brief Inserta un nodo de estudiante en el AVL y lo registra en el índice hash por ID.
+ *
+ * Primero se comprueba el índice, de modo que un ID repetido se rechaza en O(1)
+ * sin tocar el árbol. Un nodo rechazado se devuelve al pool.
+ *
+ * @param nodo Nodo creado con poolEstudiantes.
+ * @return true si se insertó; false si el ID ya existía.
+ */
+bool Sistema::insertarEstudiante(NodoAVL_Estudiantes* nodo) {
+    const int id = nodo->estudiante->getId();
+    bool insertado = false;
+    if (!indiceEstudiantes.buscar(id)) {
+        raizAVL = insertarEnAVL(raizAVL, nodo, insertado);
+    }
+    if (!insertado) {
+        poolEstudiantes.liberar(nodo);
+        return false;
+    }
+    indiceEstudiantes.insertar(id, nodo);
+    asignadorIds.marcarOcupado(id);
+    if (indiceNombresListo) indiceNombres.agregar(nodo->estudiante->getNombre(), true, id);
+    if (vistaPersistente) vistaPersistente->insertar(*nodo->estudiante);
+    sumarPreferencias(nodo->estudiante);
+    return true;
+}
+
+/**
+ * @brief Quita un estudiante del AVL y del índice, descuenta sus preferencias y libera su ranura.
+ *
+ * @param nodo Nodo enlazado en el árbol.
+ */
+void Sistema::eliminarNodoEstudiante(NodoAVL_Estudiantes* nodo) {
+    NodoAVL_Estudiantes* eliminado = nullptr;
+    raizAVL = eliminarDeAVL(raizAVL, nodo->clave, eliminado);
+    indiceEstudiantes.eliminar(nodo->estudiante->getId());
+    asignadorIds.liberar(nodo->estudiante->getId());
+    if (indiceNombresListo) indiceNombres.quitar(nodo->estudiante->getNombre(), true, nodo->estudiante->getId());
+    if (vistaPersistente) vistaPersistente->eliminar(nodo->clave);
+    restarPreferencias(nodo->estudiante);
+    poolEstudiantes.liberar(nodo);
+}
+
+/**
+ * @brief Construye un AVL perfectamente balanceado a partir de nodos ordenados por clave.
+ *
+ * Toma como raíz el nodo central del rango y construye recursivamente cada mitad,
+ * asignando las alturas directamente sin rotaciones. El costo es O(n) y la profundidad
+ * de recursión es O(log n).
+ *
+ * @param nodos Arreglo de nodos ordenado estrictamente por clave.
+ * @param inicio Primer índice del rango (incluido).
+ * @param fin Último índice del rango (excluido).
+ * @return La raíz del subárbol construido, o nullptr si el rango está vacío.
+ */
+NodoAVL_Estudiantes* construirAVLBalanceado(NodoAVL_Estudiantes* const* nodos, size_t inicio, size_t fin) {
+    if (inicio >= fin) return nullptr;
+    size_t medio = inicio + (fin - inicio) / 2;
+    NodoAVL_Estudiantes* raiz = nodos[medio];
+    raiz->izquierdo = construirAVLBalanceado(nodos, inicio, medio);
+    raiz->derecho = construirAVLBalanceado(nodos, medio + 1, fin);
+    actualizarNodo(raiz);
+    return raiz;
+}
+
+/**
+ * @brief Cuenta los nodos del AVL con clave estrictamente menor que `clave`.
+ *
+ * Desciende una sola rama sumando el tamaño de cada subárbol izquierdo que queda
+ * a la izquierda de la clave, por lo que el costo es O(log n).
+ */
+size_t contarMenores(NodoAVL_Estudiantes* nodo, uint64_t clave) {
+    size_t cantidad = 0;
+    while (nodo) {
+        if (nodo->clave < clave) {
+            cantidad += tamanio(nodo->izquierdo) + 1;
+            nodo = nodo->derecho;
+        } else {
+            nodo = nodo->izquierdo;
+        }
+    }
+    return cantidad;
+}
+
+/**
+ * @brief Cuenta los nodos del AVL con clave menor o igual que `clave`, en O(log n).
+ */
+size_t contarHasta(NodoAVL_Estudiantes* nodo, uint64_t clave) {
+    size_t cantidad = 0;
+    while (nodo) {
+        if (nodo->clave <= clave) {
+            cantidad += tamanio(nodo->izquierdo) + 1;
+            nodo = nodo->derecho;
+        } else {
+            nodo = nodo->izquierdo;
+        }
+    }
+    return cantidad;
+}
+
+/**
+ * @brief Obtiene el nodo en la posición k (desde 0) del recorrido en orden, en O(log n).
+ *
+ * @return El nodo, o nullptr si k no es menor que el tamaño del árbol.
+ */
+NodoAVL_Estudiantes* seleccionarK(NodoAVL_Estudiantes* nodo, size_t k) {
+    while (nodo) {
+        size_t izquierdos = tamanio(nodo->izquierdo);
+        if (k < izquierdos) {
+            nodo = nodo->izquierdo;
+        } else if (k == izquierdos) {
+            return nodo;
+        } else {
+            k -= izquierdos + 1;
+            nodo = nodo->derecho;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Inserta un lote de nodos de estudiantes en el AVL y en el índice por ID.
+ *
+ * Los nodos con ID repetido se informan y se devuelven al pool. Si el árbol está vacío
+ * (carga inicial), el lote se ordena por clave solo si hace falta, lo que no ocurre con
+ * archivos guardados por el propio sistema, y el árbol se construye de abajo hacia arriba
+ * en tiempo lineal. Si el árbol ya tiene datos, cada nodo se inserta de forma individual.
+ *
+ * Sin `ordenArchivo`, entre dos nodos con el mismo ID se conserva el que aparece primero en
+ * el vector. Con él (lote ordenado por clave, árbol vacío) se conserva el de menor posición
+ * en el archivo; el descartado se ubica por búsqueda binaria en la parte ya aceptada, que
+ * sigue ordenada, y se libera al final.
+ *
+ * @param nodos Nodos creados con poolEstudiantes; el vector se reutiliza como espacio de trabajo.
+ * @param ordenArchivo Posición en el archivo de cada nodo, o nullptr; también se reutiliza.
+ */
+void Sistema::insertarEstudiantesEnBloque(std::vector<NodoAVL_Estudiantes*>& nodos,
+                                          std::vector<size_t>* ordenArchivo) {
+    if (raizAVL) {
+        for (NodoAVL_Estudiantes* nodo : nodos) {
+            int id = nodo->estudiante->getId();
+            if (!insertarEstudiante(nodo)) {
+                std::cerr << "ID de estudiante repetido: " << id << "\n";
+            }
+        }
+        return;
+    }
+
+    // Marca de un nodo aceptado que luego perdió frente a uno anterior en el archivo
+    static const size_t DESCARTADO = SIZE_MAX;
+    auto menorClave = [](const NodoAVL_Estudiantes* a, uint64_t clave) { return a->clave < clave; };
+
+    indiceEstudiantes.reservar(nodos.size());
+    indiceNombresListo = false;
+    size_t aceptados = 0;
+    size_t descartados = 0;
+    for (size_t i = 0; i < nodos.size(); i++) {
+        NodoAVL_Estudiantes* nodo = nodos[i];
+        int id = nodo->estudiante->getId();
+        if (!indiceEstudiantes.insertar(id, nodo)) {
+            std::cerr << "ID de estudiante repetido: " << id << "\n";
+            NodoAVL_Estudiantes* previo = indiceEstudiantes.buscar(id);
+            size_t j = 0;
+            if (ordenArchivo) {
+                j = std::lower_bound(nodos.begin(), nodos.begin() + aceptados, previo->clave, menorClave) -
+                    nodos.begin();
+                while (nodos[j] != previo) j++;
+            }
+            if (!ordenArchivo || (*ordenArchivo)[j] < (*ordenArchivo)[i]) {
+                poolEstudiantes.liberar(nodo);
+                continue;
+            }
+            indiceEstudiantes.eliminar(id);
+            indiceEstudiantes.insertar(id, nodo);
+            restarPreferencias(previo->estudiante);
+            (*ordenArchivo)[j] = DESCARTADO;
+            descartados++;
+        }
+        asignadorIds.marcarOcupado(id);
+        sumarPreferencias(nodo->estudiante);
+        if (ordenArchivo) (*ordenArchivo)[aceptados] = (*ordenArchivo)[i];
+        nodos[aceptados++] = nodo;
+    }
+    nodos.resize(aceptados);
+
+    if (descartados > 0) {
+        size_t quedan = 0;
+        for (size_t i = 0; i < nodos.size(); i++) {
+            if ((*ordenArchivo)[i] == DESCARTADO) {
+                poolEstudiantes.liberar(nodos[i]);
+            } else {
+                nodos[quedan++] = nodos[i];
+            }
+        }
+        nodos.resize(quedan);
+    }
+
+    auto porClave = [](const NodoAVL_Estudiantes* a, const NodoAVL_Estudiantes* b) {
+        return a->clave < b->clave;
+    };
+    if (!std::is_sorted(nodos.begin(), nodos.end(), porClave)) {
+        std::sort(nodos.begin(), nodos.end(), porClave);
+    }
+    raizAVL = construirAVLBalanceado(nodos.data(), 0, nodos.size());
+    if (vistaPersistente) vistaPersistente->reconstruir(estudiantes());
+}
+
+/**
+ * @brief Crea la vista persistente con una copia de los estudiantes actuales, si no existía.
+ */
+void Sistema::activarVistaPersistente() {
+    if (vistaPersistente) return;
+    vistaPersistente = std::make_unique<ArbolPersistenteEstudiantes>();
+    vistaPersistente->reconstruir(estudiantes());
+}
+
+/**
+ * @brief Toma la versión publicada de la vista persistente.
+ */
+std::shared_ptr<const VersionEstudiantes> Sistema::instantaneaEstudiantes() const {
+    return vistaPersistente ? vistaPersistente->instantanea() : nullptr;
+}
+
+/**
+ * @brief Obtiene la cantidad de estudiantes a partir del tamaño del subárbol de la raíz.
+ */
+size_t Sistema::getNumEstudiantes() const {
+    return (size_t)tamanio(raizAVL);
+}
+
+/**
+ * @brief Cuenta las claves menores que la del primer instante de `fecha`.
+ */
+size_t Sistema::contarMatriculadosAntes(const FechaHora& fecha) const {
+    return contarMenores(raizAVL, RangoEstudiantes::claveDesde(fecha));
+}
+
+/**
+ * @brief Cuenta las claves en [desde, hasta] como la diferencia de dos rangos.
+ */
+size_t Sistema::contarMatriculadosEntre(const FechaHora& desde, const FechaHora& hasta) const {
+    uint64_t inicio = RangoEstudiantes::claveDesde(desde);
+    uint64_t fin = RangoEstudiantes::claveHasta(hasta);
+    if (inicio > fin) return 0;
+    return contarHasta(raizAVL, fin) - contarMenores(raizAVL, inicio);
+}
+
+/**
+ * @brief Selecciona el k-ésimo nodo del AVL usando los tamaños de subárbol.
+ */
+const Estudiante* Sistema::getEstudianteEnPosicion(size_t k) const {
+    NodoAVL_Estudiantes* nodo = seleccionarK(raizAVL, k);
+    return nodo ? nodo->estudiante : nullptr;
+}
+
+/**
+ * @brief Elige una posición uniforme en [0, n) y la selecciona en el AVL.
+ */
+const Estudiante* Sistema::estudianteAleatorio(std::mt19937& generador) const {
+    size_t total = getNumEstudiantes();
+    if (total == 0) return nullptr;
+    std::uniform_int_distribution<size_t> distribucion(0, total - 1);
+    return getEstudianteEnPosicion(distribucion(generador));
+}
+
+/**
+ * @brief Muestra estadísticas de matrícula calculadas con los tamaños de subárbol del AVL.
+ *
+ * Solicita una fecha de referencia ("MM/DD/YYYY HH:MM") e informa cuántos estudiantes se
+ * matricularon antes de ella, junto con las fechas de matrícula de los percentiles 25, 50 y 75,
+ * en el mismo formato.
+ */
+void Sistema::mostrarEstadisticasMatricula() {
+    size_t total = getNumEstudiantes();
+    if (total == 0) {
+        std::cout << "No hay estudiantes registrados.\n";
+        return;
+    }
+    std::string texto;
+    FechaHora fecha;
+    std::cout << "Fecha de referencia (MM/DD/YYYY HH:MM): ";
+    std::getline(std::cin, texto);
+    if (!LectorCSV::parsearFecha(texto, fecha.dia, fecha.mes, fecha.anio, fecha.hora, fecha.minuto)) {
+        std::cout << "Error: fecha invalida.\n";
+        return;
+    }
+
+    std::ostringstream salida;
+    size_t antes = contarMatriculadosAntes(fecha);
+    salida << "Total de estudiantes: " << total << "\n";
+    salida << "Matriculados antes de la fecha: " << antes
+           << " (" << (100.0 * antes / total) << "%)\n";
+    const int percentiles[] = {25, 50, 75};
+    for (int p : percentiles) {
+        const Estudiante* e = getEstudianteEnPosicion((total - 1) * p / 100);
+        salida << "Percentil " << p << ": " << e->getFechaMatricula() << "\n";
+    }
+    std::cout << salida.str();
+}
+
+/**
+ * @brief Construye un ABB de instructores perfectamente balanceado a partir de instructores ordenados por ID.
+ *
+ * Análogo a construirAVLBalanceado: el instructor central es la raíz y las alturas se asignan
+ * directamente, en tiempo O(n).
+ *
+ * @param instructores Arreglo ordenado estrictamente por ID.
+ * @param inicio Primer índice del rango (incluido).
+ * @param fin Último índice del rango (excluido).
+ * @return La raíz del subárbol construido, o nullptr si el rango está vacío.
+ */
+NodoABB_Instructores* construirABBBalanceado(Instructor* const* instructores, size_t inicio, size_t fin) {
+    if (inicio >= fin) return nullptr;
+    size_t medio = inicio + (fin - inicio) / 2;
+    NodoABB_Instructores* raiz = new NodoABB_Instructores(instructores[medio]);
+    raiz->izquierdo = construirABBBalanceado(instructores, inicio, medio);
+    raiz->derecho = construirABBBalanceado(instructores, medio + 1, fin);
+    actualizarAltura(raiz);
+    return raiz;
+}
+
+/**
+ * @brief Renombra un archivo de datos dañado para que la carga siguiente no lo sobrescriba.
+ *
+ * Usa el sufijo ".danado" y, si ya existe una copia anterior, le agrega un número.
+ *
+ * @param ruta Archivo a apartar.
+ * @return false si no se pudo renombrar.
+ */
+static bool apartarArchivo(const std::string& ruta) {
+    std::error_code ec;
+    std::string destino = ruta + ".danado";
+    for (int i = 1; std::filesystem::exists(destino, ec); i++) {
+        destino = ruta + ".danado." + std::to_string(i);
+    }
+    std::filesystem::rename(ruta, destino, ec);
+    if (ec) {
+        std::cerr << "No se pudo renombrar " << ruta << ": " << ec.message() << "\n";
+        return false;
+    }
+    std::cerr << ruta << " se conservo como " << destino << "\n";
+    return true;
+}
+
+/**
+ * @brief Carga los datos del sistema al iniciar.
+ *
+ * Intenta primero el snapshot binario y después reproduce la bitácora, que la deja abierta
+ * para seguir registrando. Solo en la primera ejecución (sin snapshot ni bitácora) se
+ * importan los CSV, y se escribe un snapshot de inmediato para que la bitácora siguiente
+ * parta de un estado conocido.
+ *
+ * Si el snapshot está dañado, o falta mientras la bitácora tiene registros, no se carga
+ * nada: los CSV pueden estar muy atrasados y la bitácora es relativa al snapshot, así que
+ * compactar encima destruiría la única copia completa. Solo con reconstruirDesdeCSV se
+ * apartan ambos archivos y se importan los CSV sin reproducir la bitácora.
+ */
+bool Sistema::cargarDatos(bool reconstruirDesdeCSV) {
+    const std::string rutaSnapshot = rutaDatos("sistema.snap");
+    const std::string rutaBitacora = rutaDatos("cambios.wal");
+    std::error_code ec;
+    const bool hayBitacora = std::filesystem::file_size(rutaBitacora, ec) > 0 && !ec;
+    const bool haySnapshot = std::filesystem::exists(rutaSnapshot, ec);
+
+    const bool desdeSnapshot = haySnapshot && cargarSnapshot();
+    if (!desdeSnapshot && (haySnapshot || hayBitacora)) {
+        if (!reconstruirDesdeCSV) {
+            std::cerr << (haySnapshot ? "sistema.snap esta danado" : "Falta sistema.snap y cambios.wal depende de el")
+                      << "; no se cargaron datos ni se modifico ningun archivo.\n"
+                      << "Para reconstruir desde los CSV (los archivos actuales se conservan con sufijo .danado),"
+                      << " use --importar-csv\n";
+            return false;
+        }
+        if ((haySnapshot && !apartarArchivo(rutaSnapshot)) || (hayBitacora && !apartarArchivo(rutaBitacora))) {
+            return false;
+        }
+    }
+    if (!desdeSnapshot) {
+        importarCSV();
+        bitacora.abrir(rutaBitacora, 0);
+        compactar();
+        return true;
+    }
+
+    bool descartados = false;
+    size_t reproducidos = BitacoraCambios::reproducir(rutaBitacora, [this](const CambioBitacora& cambio) {
+        aplicarCambio(cambio);
+    }, descartados);
+    if (descartados) {
+        std::cerr << "cambios.wal: se descarto un registro final incompleto o danado\n";
+    }
+
+    bitacora.abrir(rutaBitacora, reproducidos);
+    // Un final dañado no debe quedar delante de los registros nuevos
+    if (descartados) {
+        compactar();
+    } else {
+        compactarSiCorresponde();
+    }
+    return true;
+}
+
+/**
+ * @brief Aplica un cambio reproducido de la bitácora.
+ *
+ * @param cambio Cambio leído.
+ * @return true si modificó los datos; false si ya estaba reflejado.
+ */
+bool Sistema::aplicarCambio(const CambioBitacora& cambio) {
+    switch (cambio.tipo) {
+        case TipoCambio::MatriculaEstudiante:
+            if (idExiste(cambio.id, true)) return false;
+            return insertarEstudiante(poolEstudiantes.crear(cambio.id, cambio.nombre, cambio.dia, cambio.mes,
+                                                            cambio.anio, cambio.hora, cambio.minuto,
+                                                            cambio.preferencias, cambio.numPreferencias));
+        case TipoCambio::EliminacionInstructor:
+            if (!idExiste(cambio.id, false)) return false;
+            eliminarNodoInstructor(cambio.id);
+            return true;
+        case TipoCambio::EliminacionEstudiante: {
+            NodoAVL_Estudiantes* nodo = indiceEstudiantes.buscar(cambio.id);
+            if (!nodo) return false;
+            eliminarNodoEstudiante(nodo);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Carga ambos árboles desde el snapshot binario.
+ *
+ * Como el snapshot guarda los registros ordenados, los instructores y estudiantes se
+ * enlazan con construcciones en bloque de tiempo lineal.
+ *
+ * @return true si el snapshot existía, era válido y se cargó; si no lo era, no se cargó nada.
+ */
+bool Sistema::cargarSnapshot() {
+    const std::string ruta = rutaDatos("sistema.snap");
+    std::error_code ec;
+    if (!std::filesystem::exists(ruta, ec)) return false;
+
+    std::vector<Instructor*> instructores;
+    std::vector<NodoAVL_Estudiantes*> nodos;
+    std::string error;
+    if (!Snapshot::cargar(ruta, instructores, poolEstudiantes, nodos, error)) {
+        std::cerr << "sistema.snap no es valido (" << error << ")\n";
+        return false;
+    }
+
+    indiceNombresListo = false;
+    if (!raizABB) {
+        raizABB = construirABBBalanceado(instructores.data(), 0, instructores.size());
+    } else {
+        for (Instructor* instr : instructores) raizABB = insertarEnABB(raizABB, instr);
+    }
+    insertarEstudiantesEnBloque(nodos);
+    return true;
+}
+
+/**
+ * @brief Importa los datos de instructores y estudiantes desde archivos CSV específicos.
+ *
+ * Este método proyecta en memoria los archivos "instructores.csv" y "estudiantes.csv"
+ * y reconoce los campos de cada línea en el lugar, con `std::from_chars`, sin flujos
+ * ni cadenas intermedias. Con esos campos crea las instancias de Instructor y
+ * Estudiante, respectivamente.
+ *
+ * Los datos de los instructores incluyen ID, nombre, año de ingreso, sueldo y tipo.
+ * Los datos de los estudiantes incluyen ID, nombre, fecha y preferencias.
+ * Maneja hasta tres preferencias por cada estudiante separadas por el carácter '|'.
+ *
+ * Las filas mal formadas se informan por std::cerr con su número de línea y se omiten,
+ * en lugar de interrumpir la carga con una excepción.
+ */
+void Sistema::importarCSV() {
+    ArchivoMapeado archivo;
+    const char* error = nullptr;
+
+    // Instructores
+    if (!archivo.abrir(rutaDatos("instructores.csv"))) {
         std::cerr << "Error al abrir instructores.csv\n";
     } else {
-        std::string line;
-        while (std::getline(fileIns, line)) {
-            if (line.empty()) continue;
-            std::stringstream ss(line);
-            std::string field, nombre, tipo;
-            int id, anioIngreso;
-            double sueldo;
-            std::getline(ss, field, ','); id = std::stoi(field);
-            std::getline(ss, nombre, ',');
-            std::getline(ss, field, ','); anioIngreso = std::stoi(field);
-            std::getline(ss, field, ','); sueldo = std::stod(field);
-            std::getline(ss, tipo);
-            Instructor* instr = new Instructor(id, nombre, anioIngreso, sueldo, tipo);
+        LectorCSV::recorrerLineas(archivo.getContenido(), [&](std::string_view linea, size_t numeroLinea) {
+            FilaInstructorCSV fila;
+            if (!LectorCSV::parsearInstructor(linea, fila, error)) {
+                std::cerr << "instructores.csv:" << numeroLinea << ": fila invalida, " << error << "\n";
+                return;
+            }
+            Instructor* instr = new Instructor(fila.id, std::string(fila.nombre), fila.anioIngreso,
+                                               fila.sueldoBase, std::string(fila.tipoBaile));
             raizABB = insertarEnABB(raizABB, instr);
-        }
-        fileIns.close();
+        });
+        indiceNombresListo = false;
+        archivo.cerrar();
     }
+
     // Estudiantes
-    std::ifstream fileEst("D:/Taller3/estudiantes.csv");
-    if (!fileEst) {
+    if (!archivo.abrir(rutaDatos("estudiantes.csv"))) {
         std::cerr << "Error al abrir estudiantes.csv\n";
         return;
     }
-    std::string line2;
-    while (std::getline(fileEst, line2)) {
-        if (line2.empty()) continue;
-        std::stringstream ss(line2);
-        std::string field, nombre, fecha, prefs;
-        int id, dia, mes, anio, hora, minuto;
-        std::getline(ss, field, ','); id = std::stoi(field);
-        std::getline(ss, nombre, ',');
-        std::getline(ss, fecha, ',');
-        std::getline(ss, prefs);
-        // Parse fecha "MM/DD/YYYY HH:MM"
-        char sep;
-        std::stringstream fs(fecha);
-        fs >> mes >> sep >> dia >> sep >> anio >> hora >> sep >> minuto;
-        // Parse preferencias
-        std::string arrPref[3]; int nPref = 0;
-        std::stringstream ps(prefs);
-        while (nPref < 3 && std::getline(ps, field, '|')) {
-            arrPref[nPref++] = field;
+    cargarEstudiantesCSV(archivo.getContenido());
+    archivo.cerrar();
+}
+
+/**
+ * @brief Configura el número de hilos de análisis de estudiantes.csv.
+ *
+ * @param hilos Número de hilos (0 = automático, 1 = secuencial).
+ */
+void Sistema::setHilosCarga(int hilos) {
+    hilosCarga = hilos < 0 ? 0 : hilos;
+}
+
+/**
+ * @brief Reinicia el asignador con la nueva capacidad y vuelve a marcar los IDs en uso.
+ *
+ * @param capacidad Cantidad de IDs de estudiante.
+ * @return false si la capacidad está fuera de rango.
+ */
+bool Sistema::setCapacidadIds(int capacidad) {
+    if (capacidad < 1 || capacidad > AsignadorIds::CAPACIDAD_MAXIMA) return false;
+    asignadorIds.reiniciar(capacidad);
+    for (const Estudiante& e : estudiantes()) {
+        asignadorIds.marcarOcupado(e.getId());
+    }
+    return true;
+}
+
+// Tamaño mínimo de archivo (en bytes) a partir del cual se analiza en paralelo
+static const size_t UMBRAL_CARGA_PARALELA = 4 * 1024 * 1024;
+
+/**
+ * @brief Fila de estudiantes.csv con su clave del AVL y su línea, para ordenarla y mezclarla.
+ */
+struct FilaEstudianteConClave {
+    uint64_t clave;
+    size_t linea;               ///< Línea local al bloque; global después de analizar todos
+    FilaEstudianteCSV fila;
+};
+
+/**
+ * @brief Resultado del análisis de un bloque de estudiantes.csv en un hilo.
+ */
+struct BloqueEstudiantesCSV {
+    std::string_view texto;                                     ///< Bloque de líneas asignado
+    std::vector<FilaEstudianteConClave> filas;                  ///< Filas válidas con su clave
+    std::vector<std::pair<size_t, const char*>> errores;       ///< Línea local y motivo
+    size_t lineas = 0;                                          ///< Saltos de línea del bloque
+};
+
+/**
+ * @brief Analiza el contenido de estudiantes.csv y lo incorpora al AVL.
+ *
+ * En modo paralelo cada hilo analiza un bloque de líneas a un vector local, calcula la
+ * clave de cada fila y ordena el vector por clave (si no venía ordenado). Después se
+ * mezclan los vectores por pares, se crean los nodos en el pool en orden de clave y el
+ * árbol se construye en bloque. Los errores se informan con el número de línea global,
+ * calculado a partir de los saltos de línea de los bloques anteriores; esa misma línea
+ * decide qué fila se conserva ante un ID repetido, igual que en la carga secuencial.
+ *
+ * @param contenido Texto completo de estudiantes.csv.
+ */
+void Sistema::cargarEstudiantesCSV(std::string_view contenido) {
+    size_t hilos = hilosCarga > 0 ? (size_t)hilosCarga : std::thread::hardware_concurrency();
+    // Con datos previos no hay construcción en bloque que aprovechar
+    if (hilos < 1 || contenido.size() < UMBRAL_CARGA_PARALELA || raizAVL) hilos = 1;
+
+    // Los nodos se acumulan y se enlazan al final con una construcción en bloque
+    std::vector<NodoAVL_Estudiantes*> nodosLeidos;
+
+    if (hilos == 1) {
+        const char* error = nullptr;
+        LectorCSV::recorrerLineas(contenido, [&](std::string_view linea, size_t numeroLinea) {
+            FilaEstudianteCSV fila;
+            if (!LectorCSV::parsearEstudiante(linea, fila, error)) {
+                std::cerr << "estudiantes.csv:" << numeroLinea << ": fila invalida, " << error << "\n";
+                return;
+            }
+            nodosLeidos.push_back(poolEstudiantes.crear(fila.id, fila.nombre, fila.dia, fila.mes, fila.anio,
+                                                        fila.hora, fila.minuto, fila.preferencias,
+                                                        fila.numPreferencias));
+        });
+        insertarEstudiantesEnBloque(nodosLeidos);
+        return;
+    }
+
+    using FilaConClave = FilaEstudianteConClave;
+    auto porClave = [](const FilaConClave& a, const FilaConClave& b) { return a.clave < b.clave; };
+
+    std::vector<std::string_view> textos = LectorCSV::dividirEnBloques(contenido, hilos);
+    std::vector<BloqueEstudiantesCSV> bloques(textos.size());
+    std::vector<std::thread> trabajadores;
+    for (size_t i = 0; i < bloques.size(); i++) {
+        bloques[i].texto = textos[i];
+        trabajadores.emplace_back([&bloque = bloques[i], &porClave]() {
+            bloque.filas.reserve(bloque.texto.size() / 48);
+            const char* error = nullptr;
+            LectorCSV::recorrerLineas(bloque.texto, [&](std::string_view linea, size_t numeroLinea) {
+                FilaEstudianteCSV fila;
+                if (!LectorCSV::parsearEstudiante(linea, fila, error)) {
+                    bloque.errores.emplace_back(numeroLinea, error);
+                    return;
+                }
+                uint64_t clave = NodoAVL_Estudiantes::generarClave(fila.anio, fila.mes, fila.dia,
+                                                                    fila.hora, fila.minuto, fila.id);
+                bloque.filas.push_back(FilaConClave{clave, numeroLinea, fila});
+            });
+            bloque.lineas = (size_t)std::count(bloque.texto.begin(), bloque.texto.end(), '\n');
+            if (!std::is_sorted(bloque.filas.begin(), bloque.filas.end(), porClave)) {
+                std::stable_sort(bloque.filas.begin(), bloque.filas.end(), porClave);
+            }
+        });
+    }
+    for (std::thread& t : trabajadores) t.join();
+
+    // Errores y filas con número de línea global
+    size_t lineasPrevias = 0;
+    for (BloqueEstudiantesCSV& bloque : bloques) {
+        for (const auto& [linea, motivo] : bloque.errores) {
+            std::cerr << "estudiantes.csv:" << (lineasPrevias + linea) << ": fila invalida, " << motivo << "\n";
+        }
+        for (FilaConClave& f : bloque.filas) f.linea += lineasPrevias;
+        lineasPrevias += bloque.lineas;
+    }
+
+    // Mezcla por pares de los bloques ordenados: O(n log k)
+    std::vector<std::vector<FilaConClave>> ordenadas;
+    for (BloqueEstudiantesCSV& bloque : bloques) ordenadas.push_back(std::move(bloque.filas));
+    while (ordenadas.size() > 1) {
+        std::vector<std::vector<FilaConClave>> siguiente;
+        for (size_t i = 0; i + 1 < ordenadas.size(); i += 2) {
+            std::vector<FilaConClave> mezcla;
+            mezcla.reserve(ordenadas[i].size() + ordenadas[i + 1].size());
+            std::merge(ordenadas[i].begin(), ordenadas[i].end(),
+                       ordenadas[i + 1].begin(), ordenadas[i + 1].end(),
+                       std::back_inserter(mezcla), porClave);
+            siguiente.push_back(std::move(mezcla));
+        }
+        if (ordenadas.size() % 2 == 1) siguiente.push_back(std::move(ordenadas.back()));
+        ordenadas.swap(siguiente);
+    }
+
+    std::vector<size_t> lineas;
+    if (!ordenadas.empty()) {
+        poolEstudiantes.reservar(ordenadas[0].size());
+        nodosLeidos.reserve(ordenadas[0].size());
+        lineas.reserve(ordenadas[0].size());
+        for (const FilaConClave& f : ordenadas[0]) {
+            const FilaEstudianteCSV& fila = f.fila;
+            nodosLeidos.push_back(poolEstudiantes.crear(fila.id, fila.nombre, fila.dia, fila.mes, fila.anio,
+                                                        fila.hora, fila.minuto, fila.preferencias,
+                                                        fila.numPreferencias));
+            lineas.push_back(f.linea);
         }
-        Estudiante* est = new Estudiante(id, nombre, dia, mes, anio, hora, minuto, arrPref, nPref);
-        raizAVL = insertarEnAVL(raizAVL, est);
     }
-    fileEst.close();
+    insertarEstudiantesEnBloque(nodosLeidos, &lineas);
 }
 
 
@@ -595,20 +1813,81 @@ void Sistema::matricularEstudiante() {
         return;
     }
 
-    std::string preferencias[3];
-    int nPrefs = 0;
-    Estudiante::convertirPreferenciasATexto(numeros, nNumeros, preferencias, nPrefs);
-
-    // Generar ID único
-    int id;
-    do {
-        id = rand() % 10000;
-    } while (idExiste(id, true));
+    // Las opciones 1..5 corresponden a los estilos en el orden de EstiloBaile
+    EstiloBaile preferencias[3];
+    for (int i = 0; i < nNumeros; ++i) {
+        preferencias[i] = (EstiloBaile)(numeros[i] - 1);
+    }
 
-    Estudiante* nuevo = new Estudiante(id, nombre, dia, mes, anio, hora, minuto, preferencias, nPrefs);
-    raizAVL = insertarEnAVL(raizAVL, nuevo);
+    std::string error;
+    int existente;
+    int id = matricularEstudiante(nombre, dia, mes, anio, hora, minuto, preferencias, nNumeros, error, &existente);
+    if (id < 0) {
+        std::cout << "Error: " << error << ".\n";
+        return;
+    }
+    if (existente >= 0) {
+        std::cout << "Aviso: ya hay un estudiante matriculado con ese nombre (ID " << existente << ").\n";
+    }
     std::cout << "Estudiante matriculado con ID: " << id << "\n";
 }
 
+/**
+ * @brief Matricula a un estudiante a partir de datos ya leídos.
+ *
+ * Valida nombre, fecha, hora y preferencias, genera un ID único, inserta al estudiante
+ * en el Árbol AVL y en el índice, y registra la matrícula en la bitácora. Si se pide,
+ * consulta el índice de nombres antes de insertar para informar un homónimo.
+ *
+ * @return El ID asignado, o -1 con la causa en `error`.
+ */
+int Sistema::matricularEstudiante(const std::string& nombre, int dia, int mes, int anio, int hora, int minuto,
+                                  const EstiloBaile preferencias[], int nPrefs, std::string& error,
+                                  int* mismoNombre) {
+    if (nombre.size() > Estudiante::LARGO_MAXIMO_NOMBRE) {
+        error = "nombre demasiado largo";
+        return -1;
+    }
+    if (!Estudiante::validarNombreCompleto(nombre)) {
+        error = "nombre invalido";
+        return -1;
+    }
+    if (!Estudiante::validarFecha(dia, mes, anio) || anio > 9999) {
+        error = "fecha invalida";
+        return -1;
+    }
+    if (hora < 0 || hora > 23 || minuto < 0 || minuto > 59) {
+        error = "hora invalida";
+        return -1;
+    }
+    if (nPrefs < 1 || nPrefs > 3) {
+        error = "preferencias invalidas";
+        return -1;
+    }
+    for (int i = 0; i < nPrefs; i++) {
+        if (!codigoEstiloValido((unsigned)preferencias[i])) {
+            error = "preferencias invalidas";
+            return -1;
+        }
+    }
 
+    int id = generarIdUnico(true);
+    if (id < 0) {
+        error = "no quedan IDs disponibles";
+        return -1;
+    }
+    if (mismoNombre) *mismoNombre = buscarEstudianteMismoNombre(nombre);
 
+    // La matrícula se registra antes de insertar al estudiante: si no queda en la bitácora,
+    // no se confirma y el ID vuelve a estar libre
+    NodoAVL_Estudiantes* nodo = poolEstudiantes.crear(id, nombre, dia, mes, anio, hora, minuto, preferencias, nPrefs);
+    if (!bitacora.registrarMatricula(*nodo->estudiante)) {
+        poolEstudiantes.liberar(nodo);
+        asignadorIds.liberar(id);
+        error = "no se pudo registrar el cambio";
+        return -1;
+    }
+    insertarEstudiante(nodo);
+    compactarSiCorresponde();
+    return id;
+}
@@ -3,7 +3,18 @@
 
 #include "NodoABB_Instructores.h"
 #include "NodoAVL_Estudiantes.h"
+#include "TablaHashEstudiantes.h"
+#include "AsignadorIds.h"
+#include "IndiceNombres.h"
+#include "PoolEstudiantes.h"
+#include "BitacoraCambios.h"
+#include "MotorPagos.h"
+#include "RangoEstudiantes.h"
+#include "ArbolPersistenteEstudiantes.h"
+#include <memory>
+#include <random>
 #include <string>
+#include <vector>
 
 /**
  * @class Sistema
@@ -12,7 +23,7 @@
  * Proporciona funcionalidades para cargar y guardar datos desde o hacia archivos CSV, además de
  * manejar un menú interactivo donde se puede gestionar la matrícula de estudiantes, calcular pagos,
  * listar estudiantes, entre otras operaciones. Internamente utiliza un Árbol Binario de Búsqueda (ABB)
- * para gestionar instructores y un Árbol AVL para estudiantes.
+ * autobalanceado (criterio AVL) para gestionar instructores y un Árbol AVL para estudiantes.
  */
 class Sistema {
 private:
@@ -22,7 +33,9 @@ private:
      *
      * Gestiona y organiza la información de instructores en la estructura de Árbol Binario
      * de Búsqueda (ABB). Este puntero representa el nodo inicial del ABB, facilitando
-     * operaciones como búsqueda, inserción y eliminación de instructores.
+     * operaciones como búsqueda, inserción y eliminación de instructores. El árbol se
+     * reequilibra con rotaciones AVL, por lo que su altura es O(log n) aunque el archivo
+     * de instructores se cargue ordenado por ID.
      */
     NodoABB_Instructores* raizABB;
     /**
@@ -34,6 +47,173 @@ private:
      * y eliminación. Este puntero apunta al nodo raíz del árbol AVL.
      */
     NodoAVL_Estudiantes* raizAVL;
+    /**
+     * @variable indiceEstudiantes
+     * @brief Índice hash secundario de ID de estudiante a nodo del Árbol AVL.
+     *
+     * Se mantiene sincronizado con el AVL en cada carga e inserción, de modo que
+     * verificar o buscar un estudiante por ID no requiera recorrer el árbol.
+     */
+    TablaHashEstudiantes indiceEstudiantes;
+    /**
+     * @variable asignadorIds
+     * @brief IDs de estudiante libres, para asignar uno nuevo en O(1) al matricular.
+     *
+     * Se marca cada ID al insertar un estudiante (también durante la carga) y se libera al eliminarlo.
+     */
+    AsignadorIds asignadorIds;
+    /**
+     * @variable indiceNombres
+     * @brief Nombres de estudiantes e instructores para buscar por nombre, prefijo o apellido.
+     *
+     * Se construye al primer uso (las cargas solo lo invalidan, para no encarecer el arranque)
+     * y desde entonces se actualiza en cada matrícula y eliminación.
+     */
+    IndiceNombres indiceNombres;
+    bool indiceNombresListo;
+
+    /**
+     * @brief Quita un instructor del ABB y del índice de nombres.
+     *
+     * @param id ID de un instructor existente.
+     */
+    void eliminarNodoInstructor(int id);
+    /**
+     * @variable poolEstudiantes
+     * @brief Asignador por bloques dueño de todos los estudiantes y nodos del Árbol AVL.
+     *
+     * Cada estudiante y su nodo comparten una ranura contigua; al destruirse el sistema
+     * todos los bloques se liberan en una sola pasada.
+     */
+    PoolEstudiantes poolEstudiantes;
+    /**
+     * @variable vistaPersistente
+     * @brief Copia inmutable de los estudiantes para leerlos sin bloqueos, o nullptr si no se activó.
+     *
+     * Cuando está activa, cada inserción y eliminación en el AVL publica también una versión
+     * nueva aquí (ver activarVistaPersistente()).
+     */
+    std::unique_ptr<ArbolPersistenteEstudiantes> vistaPersistente;
+
+    /**
+     * @brief Inserta un nodo de estudiante en el Árbol AVL y lo registra en el índice por ID.
+     *
+     * Punto único de inserción de estudiantes, para que el AVL y el índice hash
+     * nunca queden desincronizados.
+     *
+     * @param nodo Nodo creado con poolEstudiantes. Si la inserción falla, se devuelve al pool.
+     * @return true si se insertó; false si ya existía un estudiante con el mismo ID.
+     */
+    bool insertarEstudiante(NodoAVL_Estudiantes* nodo);
+
+    /**
+     * @brief Inserta un lote de nodos de estudiantes, construyendo el AVL en bloque si está vacío.
+     *
+     * En una carga inicial el lote se ordena por clave (si no viene ordenado) y el árbol
+     * se arma balanceado en tiempo lineal, en lugar de insertar y rotar nodo por nodo.
+     *
+     * @param nodos Nodos creados con poolEstudiantes; los rechazados por ID repetido vuelven al pool.
+     * @param ordenArchivo Si no es nullptr, posición en el archivo de cada nodo de un lote ordenado
+     *        por clave: ante un ID repetido se conserva el que aparece primero en el archivo.
+     */
+    void insertarEstudiantesEnBloque(std::vector<NodoAVL_Estudiantes*>& nodos,
+                                     std::vector<size_t>* ordenArchivo = nullptr);
+
+    /**
+     * @brief Quita un nodo de estudiante del Árbol AVL, del índice y de los contadores, y libera su ranura.
+     *
+     * Punto único de eliminación de estudiantes, simétrico a insertarEstudiante().
+     *
+     * @param nodo Nodo enlazado en el árbol.
+     */
+    void eliminarNodoEstudiante(NodoAVL_Estudiantes* nodo);
+
+    /**
+     * @variable conteoEstilos
+     * @brief Cantidad de estudiantes que prefieren cada estilo, indexada por EstiloBaile.
+     *
+     * Se actualiza en cada matrícula, carga y eliminación de estudiantes, de modo que
+     * conocer el estilo más popular no requiere recorrer el Árbol AVL.
+     */
+    size_t conteoEstilos[NUM_ESTILOS_BAILE];
+
+    /**
+     * @brief Suma las preferencias de un estudiante a conteoEstilos.
+     */
+    void sumarPreferencias(const Estudiante* est);
+
+    /**
+     * @brief Resta las preferencias de un estudiante de conteoEstilos, al eliminarlo.
+     */
+    void restarPreferencias(const Estudiante* est);
+
+    /**
+     * @variable hilosCarga
+     * @brief Número de hilos usados para analizar estudiantes.csv (0 = automático).
+     */
+    int hilosCarga;
+
+    /**
+     * @brief Analiza el contenido de estudiantes.csv y lo incorpora al Árbol AVL.
+     *
+     * Los archivos grandes se dividen en bloques por línea que se analizan en paralelo;
+     * los resultados se ordenan por clave en cada hilo, se mezclan y se construye el árbol en bloque.
+     *
+     * @param contenido Texto completo del archivo (por ejemplo, proyectado en memoria).
+     */
+    void cargarEstudiantesCSV(std::string_view contenido);
+
+    /**
+     * @variable directorioDatos
+     * @brief Directorio (terminado en separador) donde están los CSV y el snapshot binario.
+     */
+    std::string directorioDatos;
+
+    /**
+     * @brief Construye la ruta de un archivo dentro de directorioDatos.
+     */
+    std::string rutaDatos(const char* nombreArchivo) const;
+
+    /**
+     * @variable bitacora
+     * @brief Bitácora de escritura anticipada con los cambios hechos desde el último snapshot.
+     *
+     * Cada matrícula o eliminación se agrega aquí antes de confirmarse, en lugar de
+     * reescribir todos los datos al salir.
+     */
+    BitacoraCambios bitacora;
+
+    /**
+     * @brief Aplica un cambio leído de la bitácora sin volver a registrarlo.
+     *
+     * Los cambios son idempotentes (una matrícula cuyo ID ya existe o la eliminación de un
+     * instructor ausente no hacen nada), por lo que reproducir una bitácora ya incluida en
+     * el snapshot no altera los datos.
+     *
+     * @return true si el cambio modificó los datos.
+     */
+    bool aplicarCambio(const CambioBitacora& cambio);
+
+    /**
+     * @brief Registros de bitácora a partir de los cuales conviene compactar.
+     *
+     * Crece con la cantidad de estudiantes para que el costo de escribir el snapshot
+     * se reparta entre muchos cambios.
+     */
+    size_t umbralCompactacion() const;
+
+    /**
+     * @brief Compacta la bitácora si alcanzó umbralCompactacion().
+     */
+    void compactarSiCorresponde();
+
+    /**
+     * @brief Busca un estudiante ya matriculado con el mismo nombre, sin recorrer la nómina.
+     *
+     * @param nombre Nombre completo.
+     * @return ID de un estudiante con ese nombre, o -1 si no hay ninguno.
+     */
+    int buscarEstudianteMismoNombre(const std::string& nombre);
 
 public:
     /**
@@ -41,8 +221,11 @@ public:
      *
      * Inicializa una instancia del sistema, configurando las estructuras esenciales
      * de datos como los árboles binarios para la gestión de instructores y estudiantes.
+     *
+     * @param directorioDatos Directorio (terminado en separador) donde se guardan los
+     *                        CSV y el snapshot binario.
      */
-    Sistema();
+    explicit Sistema(const std::string& directorioDatos = "D:/Taller3/");
     /**
      * @brief Destructor de la clase Sistema.
      *
@@ -52,8 +235,27 @@ public:
      */
     ~Sistema();
 
+    Sistema(const Sistema&) = delete;
+    Sistema& operator=(const Sistema&) = delete;
+
     /**
-     * @brief Carga los datos de instructores y estudiantes desde archivos CSV a las estructuras
+     * @brief Carga los datos de instructores y estudiantes a las estructuras internas del sistema.
+     *
+     * Usa el snapshot binario "sistema.snap", reproduce la bitácora "cambios.wal" y la deja
+     * abierta para registrar los cambios siguientes. Los archivos CSV solo se importan con
+     * importarCSV() en la primera ejecución, cuando no hay snapshot ni bitácora.
+     *
+     * Si el snapshot está dañado, o falta y la bitácora tiene registros, no carga nada ni
+     * toca los archivos, salvo que se pida reconstruir desde los CSV: entonces ambos se
+     * renombran con sufijo ".danado" y la bitácora no se reproduce sobre los CSV.
+     *
+     * @param reconstruirDesdeCSV true para importar los CSV en lugar del snapshot dañado.
+     * @return false si no se cargaron datos.
+     */
+    bool cargarDatos(bool reconstruirDesdeCSV = false);
+
+    /**
+     * @brief Importa los datos de instructores y estudiantes desde archivos CSV a las estructuras
      *        internas del sistema.
      *
      * Este método permite inicializar el estado de los árboles de instructores (ABB) y estudiantes (AVL)
@@ -61,17 +263,72 @@ public:
      * en estos archivos y los organiza en sus respectivas estructuras, facilitando su uso posterior
      * dentro del sistema.
      */
-    void cargarDatos();
+    void importarCSV();
+
+    /**
+     * @brief Carga ambos árboles desde el snapshot binario "sistema.snap".
+     *
+     * Valida firma, versión y suma de verificación; los registros vienen ordenados,
+     * por lo que los árboles se construyen en bloque en tiempo lineal.
+     *
+     * @return true si el snapshot existía, era válido y se cargó.
+     */
+    bool cargarSnapshot();
 
     /**
-     * @brief Guarda los datos de instructores y estudiantes en archivos CSV.
+     * @brief Configura cuántos hilos se usan para analizar estudiantes.csv en cargarDatos().
+     *
+     * Con 0 (valor por defecto) se usa la cantidad de núcleos disponibles; con 1 la carga
+     * es secuencial. Los archivos pequeños siempre se analizan en un solo hilo, ya que
+     * crear hilos costaría más que analizarlos.
+     *
+     * @param hilos Número de hilos deseado (0 = automático).
+     */
+    void setHilosCarga(int hilos);
+
+    /**
+     * @brief Cambia el tamaño del espacio de IDs de estudiante, que por omisión es [0, 10000).
+     *
+     * Las instalaciones grandes pueden ampliarlo; los estudiantes ya cargados conservan sus IDs.
+     * Cada ID del espacio ocupa 8 bytes en el asignador, por lo que el máximo es
+     * AsignadorIds::CAPACIDAD_MAXIMA (2^26 IDs, 512 MB).
+     *
+     * @param capacidad Cantidad de IDs, entre 1 y AsignadorIds::CAPACIDAD_MAXIMA.
+     * @return false si la capacidad está fuera de rango.
+     */
+    bool setCapacidadIds(int capacidad);
+
+    /**
+     * @brief Guarda el estado del sistema para el próximo inicio.
+     *
+     * Los cambios ya están en la bitácora, por lo que solo se compacta si esta superó
+     * umbralCompactacion(); los CSV solo se regeneran con exportarCSV().
+     */
+    void guardarDatos();
+
+    /**
+     * @brief Escribe un snapshot con el estado actual y vacía la bitácora.
+     *
+     * @return true si el snapshot se escribió y la bitácora quedó vacía.
+     */
+    bool compactar();
+
+    /**
+     * @brief Escribe el snapshot binario "sistema.snap" con el contenido de ambos árboles.
+     *
+     * @return true si el archivo se escribió correctamente.
+     */
+    bool guardarSnapshot();
+
+    /**
+     * @brief Exporta los datos de instructores y estudiantes a archivos CSV.
      *
      * Este método exporta la información contenida en las estructuras internas del sistema,
      * como el Árbol Binario de Búsqueda (ABB) de instructores y el Árbol AVL de estudiantes,
-     * a archivos CSV. El propósito de esta funcionalidad es asegurar la persistencia de los
-     * datos al almacenarlos en un formato accesible y reutilizable.
+     * a archivos CSV. El propósito de esta funcionalidad es disponer de los datos en un
+     * formato legible, accesible y reutilizable.
      */
-    void guardarDatos();
+    void exportarCSV();
 
     /**
      * @brief Muestra el menú interactivo principal del sistema.
@@ -94,6 +351,30 @@ public:
      */
     void matricularEstudiante();
 
+    /**
+     * @brief Matricula a un estudiante con datos ya conocidos, sin interacción.
+     *
+     * Valida los datos, asigna un ID único, inserta al estudiante y registra la
+     * matrícula en la bitácora. Es el núcleo que usa la versión interactiva.
+     *
+     * @param nombre Nombre completo (Nombre Apellido).
+     * @param dia Día de matrícula.
+     * @param mes Mes de matrícula.
+     * @param anio Año de matrícula.
+     * @param hora Hora de matrícula (0-23).
+     * @param minuto Minuto de matrícula (0-59).
+     * @param preferencias Estilos de baile preferidos, en orden.
+     * @param nPrefs Cantidad de preferencias (1-3).
+     * @param error Recibe la causa si la matrícula se rechaza, incluido un fallo al registrarla
+     *        en la bitácora (la matrícula se registra antes de insertar al estudiante).
+     * @param mismoNombre Si no es nullptr, recibe el ID de un estudiante ya matriculado con el
+     *        mismo nombre, o -1 si no había ninguno. Un nombre repetido no impide la matrícula.
+     * @return El ID asignado, o -1 si los datos no son válidos.
+     */
+    int matricularEstudiante(const std::string& nombre, int dia, int mes, int anio, int hora, int minuto,
+                             const EstiloBaile preferencias[], int nPrefs, std::string& error,
+                             int* mismoNombre = nullptr);
+
     /**
      * @brief Calcula y muestra los pagos de los instructores.
      *
@@ -103,6 +384,135 @@ public:
      * instructor, incluyendo deducciones y el sueldo líquido final.
      */
     void calcularPagos();
+
+    /**
+     * @brief Calcula los pagos de todos los instructores y los escribe en un archivo.
+     *
+     * Mismo cálculo que calcularPagos(), pero el resultado se vuelca como CSV o JSON por
+     * líneas mediante un escritor con búfer, sin pasar por la consola. Pensado para
+     * generar la planilla mensual en un proceso no interactivo.
+     *
+     * @param ruta Archivo de destino.
+     * @param formato Formato del informe.
+     * @return true si el informe se escribió.
+     */
+    bool exportarPagos(const std::string& ruta, FormatoPagos formato);
+
+    /**
+     * @brief Carga los instructores en un MotorPagos y calcula sus pagos del año en curso.
+     *
+     * Es el cálculo común a calcularPagos(), exportarPagos() y el modo por lotes.
+     */
+    void calcularMotorPagos(MotorPagos& motor) const;
+
+    /**
+     * @brief Igual que calcularMotorPagos(MotorPagos&), con el estilo que recibe el bono ya elegido.
+     *
+     * Permite tomar la popularidad de una versión de la vista persistente en lugar de los
+     * contadores del Sistema.
+     */
+    void calcularMotorPagos(MotorPagos& motor, EstiloBaile estiloPopular) const;
+
+    /**
+     * @brief Obtiene cuántos estudiantes prefieren un estilo, en tiempo constante.
+     *
+     * @param estilo Estilo consultado.
+     * @return Cantidad de estudiantes con ese estilo entre sus preferencias.
+     */
+    size_t getConteoEstilo(EstiloBaile estilo) const;
+
+    /**
+     * @brief Obtiene el estilo más popular entre los estudiantes.
+     *
+     * Ante un empate gana el primer estilo en el orden de EstiloBaile, que es el criterio
+     * con el que se asigna el bono de popularidad en calcularPagos().
+     *
+     * @return El estilo más popular (Bachata si no hay estudiantes).
+     */
+    EstiloBaile getEstiloMasPopular() const;
+
+    /**
+     * @brief Obtiene todos los estilos empatados en el primer lugar de popularidad.
+     *
+     * @return Máscara con el bit bitEstilo() de cada estilo empatado; 0 si ningún
+     *         estudiante tiene preferencias.
+     */
+    uint8_t getMascaraEstilosMasPopulares() const;
+
+    /**
+     * @brief Obtiene todos los estudiantes en orden de matrícula, para recorrerlos con un for de rango.
+     *
+     * El recorrido es iterativo, sin reservar memoria, y deja de ser válido si se matricula o
+     * elimina algún estudiante.
+     */
+    RangoEstudiantes estudiantes() const;
+
+    /**
+     * @brief Obtiene los estudiantes matriculados entre dos instantes, ambos incluidos.
+     *
+     * El rango se recorre de forma perezosa en orden de matrícula: ubicar el primer
+     * estudiante cuesta O(log n) y cada uno de los k siguientes O(1) amortizado.
+     * El rango deja de ser válido si se matricula o elimina algún estudiante.
+     *
+     * @param desde Primer instante del rango.
+     * @param hasta Último instante del rango (se incluye todo ese minuto).
+     * @param mascaraPreferencias Si no es 0, solo se entregan los estudiantes que prefieren
+     *        alguno de los estilos de la máscara (bits de bitEstilo()).
+     * @return Rango utilizable en un for de rango.
+     */
+    RangoEstudiantes estudiantesEntre(const FechaHora& desde, const FechaHora& hasta,
+                                      uint8_t mascaraPreferencias = 0) const;
+
+    /**
+     * @brief Solicita dos fechas y un estilo opcional, y lista los estudiantes matriculados en ese período.
+     */
+    void mostrarEstudiantesEntre();
+
+    /**
+     * @brief Obtiene la cantidad de estudiantes matriculados.
+     */
+    size_t getNumEstudiantes() const;
+
+    /**
+     * @brief Cuenta los estudiantes matriculados antes de un instante, en O(log n).
+     *
+     * Equivale a la posición (desde 0) que ocuparía una matrícula hecha en ese instante
+     * dentro del orden de matrícula.
+     *
+     * @param fecha Instante de referencia; las matrículas de ese mismo minuto no se cuentan.
+     * @return Cantidad de estudiantes matriculados antes de `fecha`.
+     */
+    size_t contarMatriculadosAntes(const FechaHora& fecha) const;
+
+    /**
+     * @brief Cuenta los estudiantes matriculados entre dos instantes, ambos incluidos, en O(log n).
+     *
+     * Cuenta lo mismo que recorrer estudiantesEntre(desde, hasta) sin filtro, pero sin visitarlos.
+     */
+    size_t contarMatriculadosEntre(const FechaHora& desde, const FechaHora& hasta) const;
+
+    /**
+     * @brief Obtiene el k-ésimo estudiante en orden de matrícula, en O(log n).
+     *
+     * Sirve para calcular percentiles: la mediana es getEstudianteEnPosicion(n / 2).
+     *
+     * @param k Posición desde 0.
+     * @return El estudiante, o nullptr si k no es menor que getNumEstudiantes().
+     */
+    const Estudiante* getEstudianteEnPosicion(size_t k) const;
+
+    /**
+     * @brief Elige un estudiante al azar con probabilidad uniforme, en O(log n).
+     *
+     * @param generador Generador de números aleatorios del llamador, para poder repetir una muestra.
+     * @return El estudiante elegido, o nullptr si no hay estudiantes.
+     */
+    const Estudiante* estudianteAleatorio(std::mt19937& generador) const;
+
+    /**
+     * @brief Muestra el total de matrículas, cuántas hay antes de una fecha y las fechas de los cuartiles.
+     */
+    void mostrarEstadisticasMatricula();
     /**
      * @brief Muestra un listado de todos los estudiantes matriculados.
      *
@@ -131,15 +541,55 @@ public:
      */
     void eliminarInstructor();
 
+    /**
+     * @brief Elimina el instructor con el ID dado y registra la eliminación en la bitácora.
+     *
+     * La eliminación se registra antes de modificar el árbol; si no se puede registrar,
+     * el instructor se conserva.
+     *
+     * @param id ID del instructor.
+     * @param error Si no es nullptr, recibe la causa cuando no se elimina.
+     * @return true si el instructor existía y se eliminó.
+     */
+    bool eliminarInstructor(int id, std::string* error = nullptr);
+
+    /**
+     * @brief Solicita el ID de un estudiante y lo da de baja.
+     */
+    void eliminarEstudiante();
+
+    /**
+     * @brief Da de baja al estudiante con el ID dado y registra la eliminación en la bitácora.
+     *
+     * El nodo se desenlaza del Árbol AVL con reequilibrio en O(log n) y su memoria vuelve al pool.
+     * La eliminación se registra antes de modificar los árboles; si no se puede registrar,
+     * el estudiante se conserva.
+     *
+     * @param id ID del estudiante.
+     * @param error Si no es nullptr, recibe la causa cuando no se elimina.
+     * @return true si el estudiante existía y se eliminó.
+     */
+    bool eliminarEstudiante(int id, std::string* error = nullptr);
+
+    /**
+     * @brief Da de baja a un estudiante identificado por su fecha de matrícula y su ID.
+     *
+     * @param fecha Fecha y hora de matrícula del estudiante.
+     * @param id ID del estudiante.
+     * @return true si existía un estudiante con ese ID matriculado en esa fecha y se eliminó.
+     */
+    bool eliminarEstudiante(const FechaHora& fecha, int id);
+
     /**
      * @brief Genera un identificador único para un estudiante o instructor.
      *
-     * Este método crea un ID único basado en si el identificador es requerido
-     * para un estudiante o un instructor, diferenciando entre ambos tipos.
+     * Los IDs de estudiante se toman al azar del asignador en O(1); los de instructor, que
+     * son pocos, se buscan como el menor ID de 4 dígitos sin usar. El ID de estudiante queda
+     * reservado hasta que se inserte un estudiante con él o se libere.
      *
      * @param esEstudiante Indica si el identificador generado es para un estudiante (true)
      *                     o para un instructor (false).
-     * @return Un entero que representa el identificador único generado.
+     * @return El identificador generado, o -1 si no quedan IDs disponibles.
      */
     int generarIdUnico(bool esEstudiante);
 
@@ -157,6 +607,75 @@ public:
      */
     bool idExiste(int id, bool esEstudiante);
 
+    /**
+     * @brief Busca un estudiante por su ID en tiempo constante esperado.
+     *
+     * Consulta el índice hash secundario en lugar de recorrer el Árbol AVL,
+     * que está ordenado por fecha de matrícula y no por ID.
+     *
+     * @param id El identificador del estudiante.
+     * @return Puntero al estudiante, o nullptr si no existe.
+     */
+    Estudiante* buscarEstudiantePorId(int id) const;
+
+    /**
+     * @brief Busca un instructor por ID en el ABB, en O(log n).
+     *
+     * @param id El identificador del instructor.
+     * @return Puntero al instructor encontrado, o nullptr si no existe.
+     */
+    const Instructor* buscarInstructorPorId(int id) const;
+
+    /**
+     * @brief Busca estudiantes e instructores por nombre, sin distinguir mayúsculas.
+     *
+     * @param texto Nombre completo, comienzo del nombre o apellido, según `modo`.
+     * @param modo Forma de comparar.
+     * @return Las personas encontradas.
+     */
+    std::vector<PersonaNombre> buscarPorNombre(const std::string& texto, BusquedaNombre modo);
+
+    /**
+     * @brief Igual que la versión no constante, pero sin construir el índice.
+     *
+     * Requiere que el índice esté al día (ver prepararIndiceNombres()); si no lo está, lo
+     * informa por std::cerr y no devuelve resultados. Es la que se usa con el bloqueo compartido.
+     */
+    std::vector<PersonaNombre> buscarPorNombre(const std::string& texto, BusquedaNombre modo) const;
+
+    /**
+     * @brief Construye el índice de nombres recorriendo ambos árboles, si no está al día.
+     *
+     * Las búsquedas por nombre lo llaman por su cuenta; llamarlo de antemano sirve para que
+     * esas búsquedas ya no modifiquen el Sistema (por ejemplo, antes de consultarlo desde varios hilos).
+     */
+    void prepararIndiceNombres();
+
+    /**
+     * @brief Solicita un texto y la forma de búsqueda, y lista las personas encontradas.
+     */
+    void buscarPorNombre();
+
+    /**
+     * @brief Empieza a mantener una copia persistente de los estudiantes, con versiones inmutables.
+     *
+     * La copia se arma en O(n) con los estudiantes actuales y desde entonces cada matrícula o
+     * baja publica una versión nueva en O(log n), además de modificar el AVL. Duplica la memoria
+     * de los estudiantes, por eso es opcional. Llamarlo de nuevo no hace nada.
+     */
+    void activarVistaPersistente();
+
+    /**
+     * @brief Obtiene en O(1) la versión más reciente de los estudiantes.
+     *
+     * Es la única consulta del Sistema que puede hacerse desde otro hilo mientras se matricula
+     * o se da de baja: la versión entregada no cambia y se recorre sin bloqueos. La vista
+     * debe activarse antes de compartir el Sistema entre hilos.
+     *
+     * @return La versión, o nullptr si no se llamó a activarVistaPersistente().
+     */
+    std::shared_ptr<const VersionEstudiantes> instantaneaEstudiantes() const;
+
     /**
      * @brief Obtiene el nombre del mes actual en formato de texto.
      *
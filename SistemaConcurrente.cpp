@@ -0,0 +1,135 @@
+#include "SistemaConcurrente.h"
+#include "MotorPagos.h"
+
+uint64_t SistemaConcurrente::nanosegundos(Reloj::duration duracion) {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(duracion).count();
+}
+
+/**
+ * @brief Suma una adquisición a los contadores y actualiza la retención máxima.
+ */
+void SistemaConcurrente::Contadores::registrar(uint64_t espera, uint64_t retencion) {
+    adquisiciones.fetch_add(1, std::memory_order_relaxed);
+    esperaNs.fetch_add(espera, std::memory_order_relaxed);
+    retencionNs.fetch_add(retencion, std::memory_order_relaxed);
+    uint64_t maximo = retencionMaximaNs.load(std::memory_order_relaxed);
+    while (retencion > maximo &&
+           !retencionMaximaNs.compare_exchange_weak(maximo, retencion, std::memory_order_relaxed)) {
+    }
+}
+
+MetricasBloqueo SistemaConcurrente::Contadores::leer() const {
+    return MetricasBloqueo{adquisiciones.load(std::memory_order_relaxed), esperaNs.load(std::memory_order_relaxed),
+                           retencionNs.load(std::memory_order_relaxed),
+                           retencionMaximaNs.load(std::memory_order_relaxed)};
+}
+
+SistemaConcurrente::SistemaConcurrente(Sistema& sistema) : sistema(sistema) {
+    sistema.prepararIndiceNombres();
+    sistema.activarVistaPersistente();
+}
+
+/**
+ * @brief La vista persistente ya está activa y su puntero no cambia, así que basta una carga atómica.
+ */
+std::shared_ptr<const VersionEstudiantes> SistemaConcurrente::instantaneaEstudiantes() const {
+    return sistema.instantaneaEstudiantes();
+}
+
+bool SistemaConcurrente::buscarEstudiante(int id, Estudiante& copia) const {
+    return leer([&](const Sistema& s) {
+        const Estudiante* est = s.buscarEstudiantePorId(id);
+        if (!est) return false;
+        copia = *est;
+        return true;
+    });
+}
+
+bool SistemaConcurrente::buscarInstructor(int id, Instructor& copia) const {
+    return leer([&](const Sistema& s) {
+        const Instructor* instr = s.buscarInstructorPorId(id);
+        if (!instr) return false;
+        copia = *instr;
+        return true;
+    });
+}
+
+std::vector<Estudiante> SistemaConcurrente::estudiantesEntre(const FechaHora& desde, const FechaHora& hasta,
+                                                             uint8_t mascaraPreferencias) const {
+    std::shared_ptr<const VersionEstudiantes> version = instantaneaEstudiantes();
+    std::vector<Estudiante> copias;
+    version->recorrer([&](const Estudiante& e) { copias.push_back(e); }, RangoEstudiantes::claveDesde(desde),
+                      RangoEstudiantes::claveHasta(hasta), mascaraPreferencias);
+    return copias;
+}
+
+size_t SistemaConcurrente::contarMatriculadosEntre(const FechaHora& desde, const FechaHora& hasta) const {
+    return leer([&](const Sistema& s) { return s.contarMatriculadosEntre(desde, hasta); });
+}
+
+size_t SistemaConcurrente::getNumEstudiantes() const {
+    return instantaneaEstudiantes()->getCantidad();
+}
+
+/**
+ * @brief Consulta el índice de nombres con el bloqueo compartido.
+ *
+ * Usa la versión constante de Sistema::buscarPorNombre, que no construye el índice; la
+ * fachada lo deja construido al crearse y después de cada escritura.
+ */
+std::vector<PersonaNombre> SistemaConcurrente::buscarPorNombre(const std::string& texto,
+                                                               BusquedaNombre modo) const {
+    return leer([&](const Sistema& s) { return s.buscarPorNombre(texto, modo); });
+}
+
+/**
+ * @brief Calcula los pagos con el bloqueo compartido y copia los resultados con los datos de cada instructor.
+ *
+ * El estilo más popular sale de la versión actual de los estudiantes, sin bloqueo; con el
+ * bloqueo solo se leen los instructores.
+ */
+std::vector<PagoInstructor> SistemaConcurrente::calcularPagos() const {
+    const EstiloBaile estiloPopular = instantaneaEstudiantes()->getEstiloMasPopular();
+    return leer([estiloPopular](const Sistema& s) {
+        MotorPagos motor;
+        s.calcularMotorPagos(motor, estiloPopular);
+        std::vector<PagoInstructor> pagos;
+        pagos.reserve(motor.getCantidad());
+        for (size_t i = 0; i < motor.getCantidad(); i++) {
+            const Instructor* instr = motor.getInstructor(i);
+            pagos.push_back(PagoInstructor{instr->getId(), instr->getNombreCompleto(), instr->getTipoBaile(),
+                                           motor.getSueldoBruto(i), motor.getCotizacionAFP(i),
+                                           motor.getSueldoLiquido(i)});
+        }
+        return pagos;
+    });
+}
+
+int SistemaConcurrente::matricularEstudiante(const std::string& nombre, int dia, int mes, int anio, int hora,
+                                             int minuto, const EstiloBaile preferencias[], int nPrefs,
+                                             std::string& error, int* mismoNombre) {
+    return escribir([&](Sistema& s) {
+        return s.matricularEstudiante(nombre, dia, mes, anio, hora, minuto, preferencias, nPrefs, error,
+                                      mismoNombre);
+    });
+}
+
+bool SistemaConcurrente::eliminarEstudiante(int id, std::string* error) {
+    return escribir([&](Sistema& s) { return s.eliminarEstudiante(id, error); });
+}
+
+bool SistemaConcurrente::eliminarInstructor(int id, std::string* error) {
+    return escribir([&](Sistema& s) { return s.eliminarInstructor(id, error); });
+}
+
+void SistemaConcurrente::guardarDatos() {
+    escribir([](Sistema& s) { s.guardarDatos(); });
+}
+
+MetricasBloqueo SistemaConcurrente::getMetricasLectura() const {
+    return lecturas.leer();
+}
+
+MetricasBloqueo SistemaConcurrente::getMetricasEscritura() const {
+    return escrituras.leer();
+}
@@ -0,0 +1,219 @@
+#ifndef SISTEMA_CONCURRENTE_H
+#define SISTEMA_CONCURRENTE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+#include "BloqueoLecturaEscritura.h"
+#include "Sistema.h"
+
+/**
+ * @brief Estadísticas acumuladas de un tipo de bloqueo (lectura o escritura).
+ */
+struct MetricasBloqueo {
+    uint64_t adquisiciones;         ///< Veces que se tomó el bloqueo
+    uint64_t esperaNs;              ///< Tiempo total esperando para tomarlo
+    uint64_t retencionNs;           ///< Tiempo total con el bloqueo tomado
+    uint64_t retencionMaximaNs;     ///< Retención más larga observada
+};
+
+/**
+ * @brief Pago calculado de un instructor, copiado fuera del bloqueo.
+ */
+struct PagoInstructor {
+    int id;
+    std::string nombre;
+    std::string tipoBaile;
+    double sueldoBruto;
+    double cotizacionAFP;
+    double sueldoLiquido;
+};
+
+/**
+ * @class SistemaConcurrente
+ * @brief Fachada que permite usar un Sistema desde varios hilos.
+ *
+ * Las consultas toman un bloqueo compartido, por lo que pueden ejecutarse a la vez en
+ * distintos núcleos; las matrículas, eliminaciones y el guardado toman un bloqueo exclusivo
+ * y quedan serializados. El bloqueo (BloqueoLecturaEscritura) prefiere a los escritores:
+ * uno en espera detiene la entrada de lectores nuevos, así que una ráfaga continua de
+ * consultas no posterga las matrículas indefinidamente. Los resultados de las consultas se
+ * entregan como copias, ya que un puntero a un estudiante o instructor deja de ser seguro en
+ * cuanto se suelta el bloqueo.
+ *
+ * Los listados de estudiantes no toman el bloqueo: se recorren sobre una versión inmutable
+ * de la vista persistente del Sistema (ver Sistema::activarVistaPersistente()), que se obtiene
+ * en O(1), de modo que un listado largo no detiene las matrículas ni es detenido por ellas.
+ *
+ * Para operaciones no cubiertas, leer() y escribir() ejecutan una función cualquiera sobre
+ * el Sistema con el bloqueo correspondiente. Todas las adquisiciones se miden: cantidad,
+ * tiempo de espera y tiempo de retención, por separado para lectura y escritura.
+ */
+class SistemaConcurrente {
+private:
+    /**
+     * @brief Contadores atómicos de un tipo de bloqueo.
+     */
+    struct Contadores {
+        std::atomic<uint64_t> adquisiciones{0};
+        std::atomic<uint64_t> esperaNs{0};
+        std::atomic<uint64_t> retencionNs{0};
+        std::atomic<uint64_t> retencionMaximaNs{0};
+
+        void registrar(uint64_t espera, uint64_t retencion);
+        MetricasBloqueo leer() const;
+    };
+
+    Sistema& sistema;
+    mutable BloqueoLecturaEscritura bloqueo;
+    mutable Contadores lecturas;
+    mutable Contadores escrituras;
+
+    using Reloj = std::chrono::steady_clock;
+
+    static uint64_t nanosegundos(Reloj::duration duracion);
+
+public:
+    /**
+     * @brief Envuelve un Sistema ya cargado.
+     *
+     * Deja construidos los índices que el Sistema arma al primer uso, para que las
+     * consultas concurrentes no tengan que modificarlo, y activa su vista persistente.
+     *
+     * @param sistema Sistema a proteger; no debe usarse directamente mientras exista la fachada.
+     */
+    explicit SistemaConcurrente(Sistema& sistema);
+
+    SistemaConcurrente(const SistemaConcurrente&) = delete;
+    SistemaConcurrente& operator=(const SistemaConcurrente&) = delete;
+
+    /**
+     * @brief Ejecuta `funcion(const Sistema&)` con el bloqueo compartido.
+     *
+     * La función no debe conservar punteros o rangos del Sistema después de retornar.
+     */
+    template <typename Funcion>
+    decltype(auto) leer(Funcion&& funcion) const;
+
+    /**
+     * @brief Ejecuta `funcion(Sistema&)` con el bloqueo exclusivo.
+     */
+    template <typename Funcion>
+    decltype(auto) escribir(Funcion&& funcion);
+
+    // Consultas (bloqueo compartido)
+
+    /**
+     * @brief Copia los datos de un estudiante.
+     *
+     * @return false si no existe un estudiante con ese ID.
+     */
+    bool buscarEstudiante(int id, Estudiante& copia) const;
+
+    /**
+     * @brief Copia los datos de un instructor.
+     *
+     * @return false si no existe un instructor con ese ID.
+     */
+    bool buscarInstructor(int id, Instructor& copia) const;
+
+    /**
+     * @brief Obtiene la versión actual de los estudiantes, sin bloqueo.
+     *
+     * La versión puede conservarse y recorrerse el tiempo que haga falta; no refleja los
+     * cambios posteriores.
+     */
+    std::shared_ptr<const VersionEstudiantes> instantaneaEstudiantes() const;
+
+    /**
+     * @brief Copia los estudiantes matriculados entre dos instantes, con filtro opcional de estilos.
+     *
+     * Se recorre la versión actual, sin bloqueo.
+     */
+    std::vector<Estudiante> estudiantesEntre(const FechaHora& desde, const FechaHora& hasta,
+                                             uint8_t mascaraPreferencias = 0) const;
+
+    size_t contarMatriculadosEntre(const FechaHora& desde, const FechaHora& hasta) const;
+
+    /**
+     * @brief Cantidad de estudiantes de la versión actual, sin bloqueo.
+     */
+    size_t getNumEstudiantes() const;
+
+    /**
+     * @brief Busca estudiantes e instructores por nombre.
+     */
+    std::vector<PersonaNombre> buscarPorNombre(const std::string& texto, BusquedaNombre modo) const;
+
+    /**
+     * @brief Calcula la planilla de pagos del mes sin modificar los datos.
+     */
+    std::vector<PagoInstructor> calcularPagos() const;
+
+    // Modificaciones (bloqueo exclusivo)
+
+    /**
+     * @brief Matricula un estudiante; mismos parámetros y resultado que Sistema::matricularEstudiante.
+     */
+    int matricularEstudiante(const std::string& nombre, int dia, int mes, int anio, int hora, int minuto,
+                             const EstiloBaile preferencias[], int nPrefs, std::string& error,
+                             int* mismoNombre = nullptr);
+
+    /**
+     * @brief Eliminaciones; mismos parámetros y resultado que las de Sistema.
+     */
+    bool eliminarEstudiante(int id, std::string* error = nullptr);
+    bool eliminarInstructor(int id, std::string* error = nullptr);
+
+    /**
+     * @brief Guarda los datos; excluye a las escrituras mientras se recorren los árboles.
+     */
+    void guardarDatos();
+
+    // Métricas
+
+    MetricasBloqueo getMetricasLectura() const;
+    MetricasBloqueo getMetricasEscritura() const;
+};
+
+template <typename Funcion>
+decltype(auto) SistemaConcurrente::leer(Funcion&& funcion) const {
+    const Reloj::time_point pedido = Reloj::now();
+    std::shared_lock<BloqueoLecturaEscritura> guardia(bloqueo);
+    const Reloj::time_point tomado = Reloj::now();
+    // El registro ocurre al destruirse, después de la función y antes de soltar el bloqueo
+    struct Medicion {
+        Contadores& contadores;
+        Reloj::time_point pedido, tomado;
+        ~Medicion() {
+            contadores.registrar(nanosegundos(tomado - pedido), nanosegundos(Reloj::now() - tomado));
+        }
+    } medicion{lecturas, pedido, tomado};
+    return funcion(static_cast<const Sistema&>(sistema));
+}
+
+template <typename Funcion>
+decltype(auto) SistemaConcurrente::escribir(Funcion&& funcion) {
+    const Reloj::time_point pedido = Reloj::now();
+    std::unique_lock<BloqueoLecturaEscritura> guardia(bloqueo);
+    const Reloj::time_point tomado = Reloj::now();
+    struct Medicion {
+        Sistema& sistema;
+        Contadores& contadores;
+        Reloj::time_point pedido, tomado;
+        ~Medicion() {
+            // Una escritura pudo invalidar el índice de nombres; se reconstruye aquí, con
+            // el bloqueo exclusivo, y no en la próxima lectura
+            sistema.prepararIndiceNombres();
+            contadores.registrar(nanosegundos(tomado - pedido), nanosegundos(Reloj::now() - tomado));
+        }
+    } medicion{sistema, escrituras, pedido, tomado};
+    return funcion(sistema);
+}
+
+#endif // SISTEMA_CONCURRENTE_H
@@ -0,0 +1,296 @@
+#include "Snapshot.h"
+#include "ArchivoMapeado.h"
+#include "EscritorAtomico.h"
+#include "RangoEstudiantes.h"
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+
+const char FIRMA[8] = {'T', 'L', 'R', '3', 'S', 'N', 'A', 'P'};
+
+// Cabecera del archivo
+struct Cabecera {
+    char firma[8];
+    uint32_t version;
+    uint32_t reservado;
+    uint64_t numInstructores;
+    uint64_t numEstudiantes;
+    uint64_t bytesCadenas;
+    uint64_t suma;          // FNV-1a de todo lo que sigue a la cabecera
+};
+
+// Referencia a un texto de la tabla de cadenas
+struct RefCadena {
+    uint32_t desplazamiento;
+    uint32_t largo;
+};
+
+struct RegistroInstructor {
+    int32_t id;
+    int32_t anioIngreso;
+    double sueldoBase;
+    RefCadena nombre;
+    RefCadena tipoBaile;
+};
+
+struct RegistroEstudiante {
+    uint64_t clave;         // Fecha de matrícula + ID, ver NodoAVL_Estudiantes::generarClave
+    RefCadena nombre;
+    uint8_t numPreferencias;
+    uint8_t preferencias[3];    // Códigos de EstiloBaile, en orden
+    uint32_t reservado;
+};
+
+static_assert(sizeof(Cabecera) == 48, "cabecera de tamaño fijo");
+static_assert(sizeof(RegistroInstructor) == 32, "registro de instructor de tamaño fijo");
+static_assert(sizeof(RegistroEstudiante) == 24, "registro de estudiante de tamaño fijo");
+
+/**
+ * @brief Tabla de cadenas internadas usada al escribir: cada texto distinto se agrega una vez.
+ */
+class TablaCadenas {
+private:
+    // Hash transparente: permite buscar con string_view sin construir un std::string
+    struct HashTexto {
+        using is_transparent = void;
+        size_t operator()(std::string_view s) const { return std::hash<std::string_view>{}(s); }
+    };
+
+    std::string bytes;
+    std::unordered_map<std::string, RefCadena, HashTexto, std::equal_to<>> indice;
+
+public:
+    RefCadena internar(std::string_view texto) {
+        auto it = indice.find(texto);
+        if (it != indice.end()) return it->second;
+        RefCadena ref{(uint32_t)bytes.size(), (uint32_t)texto.size()};
+        bytes.append(texto.data(), texto.size());
+        indice.emplace(std::string(texto), ref);
+        return ref;
+    }
+
+    const std::string& getBytes() const { return bytes; }
+};
+
+void recolectarInstructores(NodoABB_Instructores* nodo, std::vector<RegistroInstructor>& salida,
+                            TablaCadenas& cadenas) {
+    if (!nodo) return;
+    recolectarInstructores(nodo->izquierdo, salida, cadenas);
+    const Instructor* instr = nodo->instructor;
+    RegistroInstructor r{};
+    r.id = instr->getId();
+    r.anioIngreso = instr->getAnioIngreso();
+    r.sueldoBase = instr->getSueldoBase();
+    r.nombre = cadenas.internar(instr->getNombreCompleto());
+    r.tipoBaile = cadenas.internar(instr->getTipoBaile());
+    salida.push_back(r);
+    recolectarInstructores(nodo->derecho, salida, cadenas);
+}
+
+void recolectarEstudiantes(NodoAVL_Estudiantes* raiz, std::vector<RegistroEstudiante>& salida,
+                           TablaCadenas& cadenas) {
+    RangoEstudiantes estudiantes(raiz);
+    for (auto it = estudiantes.begin(); it != estudiantes.end(); ++it) {
+        const Estudiante& est = *it;
+        RegistroEstudiante r{};
+        r.clave = it.nodo()->clave;
+        r.nombre = cadenas.internar(est.getNombre());
+        r.numPreferencias = (uint8_t)est.getNumPreferencias();
+        for (int i = 0; i < est.getNumPreferencias(); i++) {
+            r.preferencias[i] = (uint8_t)est.getEstiloPreferencia(i);
+        }
+        salida.push_back(r);
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Calcula FNV-1a de 64 bits tomando palabras de 8 bytes (y el resto byte a byte).
+ *
+ * Procesar por palabras reduce la cadena de multiplicaciones a una por cada 8 bytes,
+ * lo que mantiene la verificación cerca de la velocidad de lectura de memoria.
+ *
+ * @param datos Inicio del bloque.
+ * @param tamanio Tamaño en bytes.
+ * @return Suma de verificación.
+ */
+uint64_t Snapshot::sumaVerificacion(const char* datos, size_t tamanio) {
+    const uint64_t PRIMO = 0x100000001B3ULL;
+    uint64_t h = 0xCBF29CE484222325ULL;
+    size_t i = 0;
+    for (; i + 8 <= tamanio; i += 8) {
+        uint64_t palabra;
+        std::memcpy(&palabra, datos + i, 8);
+        h = (h ^ palabra) * PRIMO;
+    }
+    for (; i < tamanio; i++) {
+        h = (h ^ (unsigned char)datos[i]) * PRIMO;
+    }
+    return h;
+}
+
+/**
+ * @brief Serializa ambos árboles en un búfer y lo escribe de una vez, reemplazando el archivo anterior
+ *        de forma atómica.
+ *
+ * Los recorridos en orden dejan los instructores ordenados por ID y los estudiantes por clave.
+ *
+ * @return true si el archivo se escribió correctamente.
+ */
+bool Snapshot::guardar(const std::string& ruta, NodoABB_Instructores* raizABB,
+                       NodoAVL_Estudiantes* raizAVL, std::string& error) {
+    TablaCadenas cadenas;
+    std::vector<RegistroInstructor> instructores;
+    std::vector<RegistroEstudiante> estudiantes;
+    recolectarInstructores(raizABB, instructores, cadenas);
+    estudiantes.reserve(raizAVL ? raizAVL->tamanio : 0);
+    recolectarEstudiantes(raizAVL, estudiantes, cadenas);
+
+    const size_t bytesInstructores = instructores.size() * sizeof(RegistroInstructor);
+    const size_t bytesEstudiantes = estudiantes.size() * sizeof(RegistroEstudiante);
+    const std::string& bytesCadenas = cadenas.getBytes();
+
+    std::string buffer(sizeof(Cabecera) + bytesInstructores + bytesEstudiantes + bytesCadenas.size(), '\0');
+    char* p = buffer.data() + sizeof(Cabecera);
+    if (bytesInstructores) std::memcpy(p, instructores.data(), bytesInstructores);
+    p += bytesInstructores;
+    if (bytesEstudiantes) std::memcpy(p, estudiantes.data(), bytesEstudiantes);
+    p += bytesEstudiantes;
+    if (!bytesCadenas.empty()) std::memcpy(p, bytesCadenas.data(), bytesCadenas.size());
+
+    Cabecera cab{};
+    std::memcpy(cab.firma, FIRMA, sizeof(FIRMA));
+    cab.version = VERSION;
+    cab.numInstructores = instructores.size();
+    cab.numEstudiantes = estudiantes.size();
+    cab.bytesCadenas = bytesCadenas.size();
+    cab.suma = sumaVerificacion(buffer.data() + sizeof(Cabecera), buffer.size() - sizeof(Cabecera));
+    std::memcpy(buffer.data(), &cab, sizeof(Cabecera));
+
+    // Se reemplaza de forma atómica: una caída a mitad de escritura conserva el snapshot anterior
+    EscritorAtomico salida;
+    if (!salida.abrir(ruta)) {
+        error = "no se pudo abrir " + ruta + " para escritura";
+        return false;
+    }
+    salida.escribir(buffer);
+    return salida.confirmar(error);
+}
+
+/**
+ * @brief Valida y lee un snapshot proyectado en memoria.
+ *
+ * La cabecera, los tamaños, la suma y los instructores se comprueban antes de crear
+ * objetos; los estudiantes se validan al crearlos y, ante un registro inválido, los ya
+ * creados vuelven al pool. Así un archivo truncado o alterado se rechaza sin efectos
+ * secundarios. Como los árboles se construyen en bloque a partir del orden del archivo,
+ * también se exige que los IDs de instructores y las claves de estudiantes sean
+ * estrictamente crecientes.
+ *
+ * @return true si el snapshot se cargó.
+ */
+bool Snapshot::cargar(const std::string& ruta, std::vector<Instructor*>& instructores,
+                      PoolEstudiantes& pool, std::vector<NodoAVL_Estudiantes*>& nodos,
+                      std::string& error) {
+    ArchivoMapeado archivo;
+    if (!archivo.abrir(ruta)) {
+        error = "no existe " + ruta;
+        return false;
+    }
+    std::string_view contenido = archivo.getContenido();
+    Cabecera cab;
+    if (contenido.size() < sizeof(Cabecera)) {
+        error = "archivo truncado";
+        return false;
+    }
+    std::memcpy(&cab, contenido.data(), sizeof(Cabecera));
+    if (std::memcmp(cab.firma, FIRMA, sizeof(FIRMA)) != 0) {
+        error = "firma invalida";
+        return false;
+    }
+    if (cab.version != VERSION) {
+        error = "version " + std::to_string(cab.version) + " no soportada";
+        return false;
+    }
+    const uint64_t cuerpo = contenido.size() - sizeof(Cabecera);
+    if (cab.numInstructores > cuerpo / sizeof(RegistroInstructor) ||
+        cab.numEstudiantes > cuerpo / sizeof(RegistroEstudiante) ||
+        cab.numInstructores * sizeof(RegistroInstructor) + cab.numEstudiantes * sizeof(RegistroEstudiante)
+            + cab.bytesCadenas != cuerpo) {
+        error = "tamanios inconsistentes";
+        return false;
+    }
+    const char* base = contenido.data() + sizeof(Cabecera);
+    if (sumaVerificacion(base, cuerpo) != cab.suma) {
+        error = "suma de verificacion incorrecta";
+        return false;
+    }
+
+    const char* regInstructores = base;
+    const char* regEstudiantes = regInstructores + cab.numInstructores * sizeof(RegistroInstructor);
+    const char* tabla = regEstudiantes + cab.numEstudiantes * sizeof(RegistroEstudiante);
+    auto valida = [&](const RefCadena& ref) {
+        return (uint64_t)ref.desplazamiento + ref.largo <= cab.bytesCadenas;
+    };
+    auto texto = [&](const RefCadena& ref) {
+        return std::string_view(tabla + ref.desplazamiento, ref.largo);
+    };
+    // Validar los instructores antes de construir objetos: referencias y orden estricto por ID
+    for (uint64_t i = 0; i < cab.numInstructores; i++) {
+        RegistroInstructor r;
+        std::memcpy(&r, regInstructores + i * sizeof(RegistroInstructor), sizeof(r));
+        if (!valida(r.nombre) || !valida(r.tipoBaile)) {
+            error = "referencia de cadena fuera de rango";
+            return false;
+        }
+        if (i > 0) {
+            int32_t idAnterior;
+            std::memcpy(&idAnterior, regInstructores + (i - 1) * sizeof(RegistroInstructor), sizeof(idAnterior));
+            if (r.id <= idAnterior) {
+                error = "instructores fuera de orden";
+                return false;
+            }
+        }
+    }
+
+    // Los estudiantes se decodifican una sola vez, creando cada nodo al validarlo; si un
+    // registro es inválido se devuelven al pool los nodos ya creados
+    const size_t nodosPrevios = nodos.size();
+    auto descartarEstudiantes = [&](const char* motivo) {
+        for (size_t i = nodosPrevios; i < nodos.size(); i++) pool.liberar(nodos[i]);
+        nodos.resize(nodosPrevios);
+        error = motivo;
+        return false;
+    };
+    pool.reservar(cab.numEstudiantes);
+    nodos.reserve(nodosPrevios + cab.numEstudiantes);
+    for (uint64_t i = 0; i < cab.numEstudiantes; i++) {
+        RegistroEstudiante r;
+        std::memcpy(&r, regEstudiantes + i * sizeof(RegistroEstudiante), sizeof(r));
+        if (r.numPreferencias > 3 || !valida(r.nombre)) return descartarEstudiantes("registro de estudiante invalido");
+        EstiloBaile prefs[3];
+        for (int k = 0; k < r.numPreferencias; k++) {
+            if (!codigoEstiloValido(r.preferencias[k])) return descartarEstudiantes("registro de estudiante invalido");
+            prefs[k] = (EstiloBaile)r.preferencias[k];
+        }
+        if (nodos.size() > nodosPrevios && r.clave <= nodos.back()->clave) {
+            return descartarEstudiantes("estudiantes fuera de orden");
+        }
+        int anio, mes, dia, hora, minuto, id;
+        NodoAVL_Estudiantes::desempaquetarClave(r.clave, anio, mes, dia, hora, minuto, id);
+        nodos.push_back(pool.crear(id, texto(r.nombre), dia, mes, anio, hora, minuto, prefs,
+                                   (int)r.numPreferencias));
+    }
+
+    instructores.reserve(instructores.size() + cab.numInstructores);
+    for (uint64_t i = 0; i < cab.numInstructores; i++) {
+        RegistroInstructor r;
+        std::memcpy(&r, regInstructores + i * sizeof(RegistroInstructor), sizeof(r));
+        instructores.push_back(new Instructor(r.id, std::string(texto(r.nombre)), r.anioIngreso,
+                                              r.sueldoBase, std::string(texto(r.tipoBaile))));
+    }
+    return true;
+}
@@ -0,0 +1,72 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "NodoABB_Instructores.h"
+#include "NodoAVL_Estudiantes.h"
+#include "PoolEstudiantes.h"
+
+/**
+ * @class Snapshot
+ * @brief Formato binario versionado para guardar y restaurar ambos árboles del sistema.
+ *
+ * Estructura del archivo (enteros en el orden de bytes del equipo, little-endian en la práctica):
+ *  - Cabecera de 48 bytes: firma "TLR3SNAP", versión, cantidad de instructores, cantidad de
+ *    estudiantes, tamaño de la tabla de cadenas y suma de verificación del resto del archivo.
+ *  - Registros de instructores de ancho fijo, ordenados por ID.
+ *  - Registros de estudiantes de ancho fijo, ordenados por clave (fecha de matrícula + ID),
+ *    con las preferencias como códigos de EstiloBaile.
+ *  - Tabla de cadenas internadas: cada texto distinto (nombres, estilos de instructores) se
+ *    guarda una sola vez y los registros lo referencian por desplazamiento y largo.
+ *
+ * Como los registros ya vienen ordenados, cargar un snapshot consiste en validar la cabecera,
+ * recorrer registros contiguos y construir los árboles en bloque, sin analizar texto.
+ */
+class Snapshot {
+public:
+    /// Versión del formato; un archivo con otra versión se rechaza y se importan los CSV.
+    static const uint32_t VERSION = 1;
+
+    /**
+     * @brief Escribe un snapshot con el contenido de ambos árboles.
+     *
+     * @param ruta Ruta del archivo a escribir.
+     * @param raizABB Raíz del ABB de instructores.
+     * @param raizAVL Raíz del AVL de estudiantes.
+     * @param error Recibe la descripción del problema si la escritura falla.
+     * @return true si el archivo se escribió completo.
+     */
+    static bool guardar(const std::string& ruta, NodoABB_Instructores* raizABB,
+                        NodoAVL_Estudiantes* raizAVL, std::string& error);
+
+    /**
+     * @brief Lee un snapshot, validando firma, versión, tamaños y suma de verificación.
+     *
+     * Los instructores se crean con `new` y los estudiantes en el pool indicado; ambos
+     * se devuelven en el orden del archivo (por ID y por clave, respectivamente), listos
+     * para una construcción en bloque. Si el archivo es inválido no se crea ningún objeto.
+     *
+     * @param ruta Ruta del archivo a leer.
+     * @param instructores Recibe los instructores leídos.
+     * @param pool Pool donde se crean los estudiantes y sus nodos.
+     * @param nodos Recibe los nodos de estudiantes leídos.
+     * @param error Recibe la descripción del problema si la lectura falla.
+     * @return true si el snapshot era válido y se cargó.
+     */
+    static bool cargar(const std::string& ruta, std::vector<Instructor*>& instructores,
+                       PoolEstudiantes& pool, std::vector<NodoAVL_Estudiantes*>& nodos,
+                       std::string& error);
+
+    /**
+     * @brief Suma de verificación FNV-1a de 64 bits, aplicada por palabras de 8 bytes.
+     *
+     * @param datos Inicio del bloque.
+     * @param tamanio Tamaño del bloque en bytes.
+     * @return Valor de la suma.
+     */
+    static uint64_t sumaVerificacion(const char* datos, size_t tamanio);
+};
+
+#endif // SNAPSHOT_H
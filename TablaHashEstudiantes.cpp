@@ -0,0 +1,151 @@
+#include "TablaHashEstudiantes.h"
+
+// Capacidad mínima de la tabla (potencia de dos)
+static const size_t CAPACIDAD_INICIAL = 16;
+
+/**
+ * @brief Constructor de la tabla hash de estudiantes.
+ *
+ * Reserva la capacidad inicial con todas las casillas vacías.
+ */
+TablaHashEstudiantes::TablaHashEstudiantes()
+    : entradas(CAPACIDAD_INICIAL, Entrada{0, nullptr}),
+      cantidad(0)
+{
+}
+
+/**
+ * @brief Calcula la casilla inicial de un ID.
+ *
+ * Multiplica el ID por la constante de Fibonacci de 64 bits y toma los bits altos,
+ * lo que reparte bien los IDs consecutivos a lo largo de la tabla.
+ *
+ * @param id ID del estudiante.
+ * @return Índice de la casilla inicial dentro de `entradas`.
+ */
+size_t TablaHashEstudiantes::posicionInicial(int id) const {
+    unsigned long long h = (unsigned long long)(unsigned int)id * 0x9E3779B97F4A7C15ULL;
+    return (size_t)(h >> 32) & (entradas.size() - 1);
+}
+
+/**
+ * @brief Reconstruye la tabla con otra capacidad.
+ *
+ * @param nuevaCapacidad Nueva capacidad (potencia de dos, mayor que la cantidad actual).
+ */
+void TablaHashEstudiantes::redimensionar(size_t nuevaCapacidad) {
+    std::vector<Entrada> anteriores(nuevaCapacidad, Entrada{0, nullptr});
+    anteriores.swap(entradas);
+    const size_t mascara = entradas.size() - 1;
+    for (const Entrada& e : anteriores) {
+        if (!e.nodo) continue;
+        size_t i = posicionInicial(e.id);
+        while (entradas[i].nodo) i = (i + 1) & mascara;
+        entradas[i] = e;
+    }
+}
+
+/**
+ * @brief Registra un ID con su nodo del AVL.
+ *
+ * Mantiene el factor de carga por debajo de 0.7 duplicando la capacidad cuando es necesario.
+ *
+ * @param id ID del estudiante.
+ * @param nodo Nodo del AVL asociado.
+ * @return true si se insertó; false si el ID ya existía.
+ */
+bool TablaHashEstudiantes::insertar(int id, NodoAVL_Estudiantes* nodo) {
+    if ((cantidad + 1) * 10 > entradas.size() * 7) {
+        redimensionar(entradas.size() * 2);
+    }
+    const size_t mascara = entradas.size() - 1;
+    size_t i = posicionInicial(id);
+    while (entradas[i].nodo) {
+        if (entradas[i].id == id) return false;
+        i = (i + 1) & mascara;
+    }
+    entradas[i] = Entrada{id, nodo};
+    cantidad++;
+    return true;
+}
+
+/**
+ * @brief Busca el nodo asociado a un ID recorriendo su cúmulo de sondeo lineal.
+ *
+ * @param id ID a buscar.
+ * @return El nodo del AVL, o nullptr si no existe.
+ */
+NodoAVL_Estudiantes* TablaHashEstudiantes::buscar(int id) const {
+    const size_t mascara = entradas.size() - 1;
+    size_t i = posicionInicial(id);
+    while (entradas[i].nodo) {
+        if (entradas[i].id == id) return entradas[i].nodo;
+        i = (i + 1) & mascara;
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Elimina un ID del índice.
+ *
+ * Tras vaciar la casilla, recorre el resto del cúmulo y mueve hacia atrás cada entrada
+ * cuya casilla inicial no quede entre el hueco y su posición actual, de modo que las
+ * búsquedas posteriores nunca se corten antes de tiempo.
+ *
+ * @param id ID a eliminar.
+ * @return true si el ID existía; false en caso contrario.
+ */
+bool TablaHashEstudiantes::eliminar(int id) {
+    const size_t mascara = entradas.size() - 1;
+    size_t i = posicionInicial(id);
+    while (entradas[i].nodo && entradas[i].id != id) {
+        i = (i + 1) & mascara;
+    }
+    if (!entradas[i].nodo) return false;
+
+    size_t hueco = i;
+    size_t j = i;
+    while (true) {
+        j = (j + 1) & mascara;
+        if (!entradas[j].nodo) break;
+        size_t inicio = posicionInicial(entradas[j].id);
+        // La entrada j puede ocupar el hueco si su casilla inicial no está en (hueco, j]
+        bool enRango = (hueco <= j) ? (hueco < inicio && inicio <= j)
+                                    : (hueco < inicio || inicio <= j);
+        if (!enRango) {
+            entradas[hueco] = entradas[j];
+            hueco = j;
+        }
+    }
+    entradas[hueco] = Entrada{0, nullptr};
+    cantidad--;
+    return true;
+}
+
+/**
+ * @brief Reserva capacidad para n entradas manteniendo el factor de carga bajo 0.7.
+ *
+ * @param n Número de entradas esperadas.
+ */
+void TablaHashEstudiantes::reservar(size_t n) {
+    size_t capacidad = entradas.size();
+    while (n * 10 > capacidad * 7) capacidad *= 2;
+    if (capacidad != entradas.size()) redimensionar(capacidad);
+}
+
+/**
+ * @brief Vacía todas las casillas de la tabla.
+ */
+void TablaHashEstudiantes::limpiar() {
+    for (Entrada& e : entradas) e = Entrada{0, nullptr};
+    cantidad = 0;
+}
+
+/**
+ * @brief Obtiene el número de IDs registrados en el índice.
+ *
+ * @return Cantidad de entradas ocupadas.
+ */
+size_t TablaHashEstudiantes::getCantidad() const {
+    return cantidad;
+}
@@ -0,0 +1,91 @@
+#ifndef TABLAHASH_ESTUDIANTES_H
+#define TABLAHASH_ESTUDIANTES_H
+
+#include <cstddef>
+#include <vector>
+#include "NodoAVL_Estudiantes.h"
+
+/**
+ * @class TablaHashEstudiantes
+ * @brief Índice secundario de direccionamiento abierto que asocia el ID de un estudiante
+ *        con su nodo en el Árbol AVL.
+ *
+ * El AVL de estudiantes está ordenado por fecha de matrícula, por lo que buscar por ID
+ * exigiría recorrerlo completo. Esta tabla usa sondeo lineal sobre un arreglo de potencia
+ * de dos y borrado por desplazamiento hacia atrás (sin lápidas), lo que permite buscar,
+ * insertar y eliminar en O(1) esperado. Los nodos del AVL no cambian de dirección con las
+ * rotaciones, así que los punteros almacenados siguen siendo válidos mientras el nodo exista.
+ */
+class TablaHashEstudiantes {
+private:
+    /**
+     * @brief Casilla de la tabla. Una casilla está vacía cuando `nodo` es nullptr.
+     */
+    struct Entrada {
+        int id;
+        NodoAVL_Estudiantes* nodo;
+    };
+
+    std::vector<Entrada> entradas;  ///< Casillas de la tabla (capacidad potencia de dos)
+    size_t cantidad;                ///< Número de casillas ocupadas
+
+    /**
+     * @brief Calcula la casilla inicial de un ID mediante hashing multiplicativo de Fibonacci.
+     */
+    size_t posicionInicial(int id) const;
+
+    /**
+     * @brief Reconstruye la tabla con una nueva capacidad, reinsertando todas las entradas.
+     * @param nuevaCapacidad Capacidad deseada; debe ser potencia de dos.
+     */
+    void redimensionar(size_t nuevaCapacidad);
+
+public:
+    /**
+     * @brief Construye una tabla vacía con una capacidad inicial pequeña.
+     */
+    TablaHashEstudiantes();
+
+    /**
+     * @brief Registra el nodo de un estudiante bajo su ID.
+     *
+     * @param id ID del estudiante.
+     * @param nodo Nodo del AVL que contiene al estudiante.
+     * @return true si se registró; false si el ID ya estaba presente (la tabla no cambia).
+     */
+    bool insertar(int id, NodoAVL_Estudiantes* nodo);
+
+    /**
+     * @brief Busca el nodo asociado a un ID.
+     *
+     * @param id ID del estudiante a buscar.
+     * @return Puntero al nodo, o nullptr si el ID no está registrado.
+     */
+    NodoAVL_Estudiantes* buscar(int id) const;
+
+    /**
+     * @brief Quita un ID del índice, desplazando hacia atrás las entradas de su cúmulo.
+     *
+     * @param id ID del estudiante a quitar.
+     * @return true si el ID estaba registrado y fue eliminado; false en caso contrario.
+     */
+    bool eliminar(int id);
+
+    /**
+     * @brief Asegura capacidad para al menos n entradas sin redimensionar.
+     * @param n Número de entradas esperadas (por ejemplo, antes de una carga masiva).
+     */
+    void reservar(size_t n);
+
+    /**
+     * @brief Vacía el índice conservando la capacidad reservada.
+     */
+    void limpiar();
+
+    /**
+     * @brief Obtiene el número de IDs registrados.
+     */
+    size_t getCantidad() const;
+};
+
+#endif // TABLAHASH_ESTUDIANTES_H
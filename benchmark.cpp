@@ -0,0 +1,336 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include "MotorPagos.h"
+#include "NodoABB_Instructores.h"
+#include "NodoAVL_Estudiantes.h"
+#include "PoolEstudiantes.h"
+#include "Sistema.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+/*
+  Mide el costo de las operaciones centrales con n = 10^3, 10^4, ... hasta --max (10^7 por omision).
+  Cada medicion se escribe en la salida estandar como una linea JSON:
+
+    {"operacion":"avl_insertar","n":1000,"ops":1000,"ns_por_op":85.2,"ops_por_s":11737089.2,"rss_pico_kb":5120}
+
+  "n" es la cantidad de registros de la estructura medida y "ops" la cantidad de operaciones
+  cronometradas. El pico de memoria es el del proceso hasta ese momento; como los tamanos se
+  miden de menor a mayor, corresponde al tamano en curso. Con 10^7 registros el proceso llega
+  a unos 7 GB; en equipos con menos memoria conviene limitar --max.
+
+  Uso: benchmark [--max <n>] [--dir <directorio temporal>] [--semilla <s>] [--hilos <n>]
+
+  --hilos se pasa a Sistema::setHilosCarga() para importar los CSV (0 = automatico).
+*/
+
+namespace {
+
+using Reloj = std::chrono::steady_clock;
+
+const char* const NOMBRES_ESTILO[NUM_ESTILOS_BAILE] = {"Bachata", "Reggaeton", "Salsa", "Cumbia", "Tango"};
+
+// Resultados acumulados para que el compilador no descarte las consultas medidas
+volatile size_t sumidero = 0;
+
+// Pico de memoria residente del proceso, en KB
+long rssPicoKB() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS contadores;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &contadores, sizeof(contadores))) return -1;
+    return (long)(contadores.PeakWorkingSetSize / 1024);
+#else
+    rusage uso;
+    if (getrusage(RUSAGE_SELF, &uso) != 0) return -1;
+#ifdef __APPLE__
+    return uso.ru_maxrss / 1024;   // macOS lo informa en bytes
+#else
+    return uso.ru_maxrss;
+#endif
+#endif
+}
+
+void informar(const char* operacion, size_t n, size_t ops, Reloj::duration duracion) {
+    const double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(duracion).count();
+    const double nsPorOp = ops ? ns / (double)ops : 0.0;
+    const double opsPorSegundo = ns > 0 ? (double)ops * 1e9 / ns : 0.0;
+    std::printf("{\"operacion\":\"%s\",\"n\":%zu,\"ops\":%zu,\"ns_por_op\":%.1f,\"ops_por_s\":%.1f,\"rss_pico_kb\":%ld}\n",
+                operacion, n, ops, nsPorOp, opsPorSegundo, rssPicoKB());
+    std::fflush(stdout);
+}
+
+template <typename Funcion>
+Reloj::duration medir(Funcion&& funcion) {
+    const Reloj::time_point inicio = Reloj::now();
+    funcion();
+    return Reloj::now() - inicio;
+}
+
+// Fecha de matrícula al azar entre 2000 y 2024
+struct Fecha {
+    int dia, mes, anio, hora, minuto;
+};
+
+Fecha fechaAleatoria(std::mt19937& generador) {
+    return Fecha{(int)(generador() % 28) + 1, (int)(generador() % 12) + 1, 2000 + (int)(generador() % 25),
+                 (int)(generador() % 24), (int)(generador() % 60)};
+}
+
+// Entre 1 y 3 estilos distintos
+int preferenciasAleatorias(std::mt19937& generador, EstiloBaile preferencias[3]) {
+    int cantidad = 1 + (int)(generador() % 3);
+    int primero = (int)(generador() % NUM_ESTILOS_BAILE);
+    for (int i = 0; i < cantidad; i++) preferencias[i] = (EstiloBaile)((primero + i) % NUM_ESTILOS_BAILE);
+    return cantidad;
+}
+
+std::vector<int> permutacion(size_t n, std::mt19937& generador) {
+    std::vector<int> ids(n);
+    std::iota(ids.begin(), ids.end(), 0);
+    std::shuffle(ids.begin(), ids.end(), generador);
+    return ids;
+}
+
+/**
+ * @brief AVL de estudiantes: insertarEnAVL y eliminarDeAVL sobre nodos ya creados en el pool.
+ */
+void medirAVL(size_t n, std::mt19937& generador) {
+    PoolEstudiantes pool;
+    pool.reservar(n);
+    std::vector<NodoAVL_Estudiantes*> nodos;
+    nodos.reserve(n);
+    for (int id : permutacion(n, generador)) {
+        Fecha f = fechaAleatoria(generador);
+        EstiloBaile preferencias[3];
+        int numPreferencias = preferenciasAleatorias(generador, preferencias);
+        nodos.push_back(pool.crear(id, "Nom" + std::to_string(id) + " Ape", f.dia, f.mes, f.anio, f.hora, f.minuto,
+                                   preferencias, numPreferencias));
+    }
+
+    NodoAVL_Estudiantes* raiz = nullptr;
+    informar("avl_insertar", n, n, medir([&] {
+        for (NodoAVL_Estudiantes* nodo : nodos) {
+            bool insertado = false;
+            raiz = insertarEnAVL(raiz, nodo, insertado);
+        }
+    }));
+
+    std::shuffle(nodos.begin(), nodos.end(), generador);
+    informar("avl_eliminar", n, n, medir([&] {
+        for (NodoAVL_Estudiantes* nodo : nodos) {
+            NodoAVL_Estudiantes* eliminado = nullptr;
+            raiz = eliminarDeAVL(raiz, nodo->clave, eliminado);
+            sumidero = sumidero + (eliminado != nullptr);
+        }
+    }));
+}
+
+/**
+ * @brief ABB de instructores: inserción, búsqueda (mitad de aciertos) y eliminación con IDs al azar.
+ */
+void medirABB(size_t n, std::mt19937& generador) {
+    std::vector<int> ids = permutacion(n, generador);
+    std::vector<Instructor*> instructores;
+    instructores.reserve(n);
+    for (int id : ids) {
+        instructores.push_back(new Instructor(id, "Ins" + std::to_string(id) + " Ape", 2000 + id % 25,
+                                              400000 + id % 100000, NOMBRES_ESTILO[id % NUM_ESTILOS_BAILE]));
+    }
+
+    NodoABB_Instructores* raiz = nullptr;
+    informar("abb_insertar", n, n, medir([&] {
+        for (Instructor* instr : instructores) raiz = insertarEnABB(raiz, instr);
+    }));
+
+    std::vector<int> consultas(n);
+    for (size_t i = 0; i < n; i++) consultas[i] = (int)(generador() % (2 * n));
+    informar("abb_buscar", n, n, medir([&] {
+        size_t encontrados = 0;
+        for (int id : consultas) encontrados += buscarEnABB(raiz, id) != nullptr;
+        sumidero = sumidero + encontrados;
+    }));
+
+    std::shuffle(ids.begin(), ids.end(), generador);
+    informar("abb_eliminar", n, n, medir([&] {
+        for (int id : ids) raiz = eliminarNodoABB(raiz, id);
+    }));
+}
+
+// Escribe instructores.csv y estudiantes.csv con n registros cada uno
+bool escribirCSV(const std::filesystem::path& directorio, size_t n, std::mt19937& generador) {
+    std::FILE* instructores = std::fopen((directorio / "instructores.csv").string().c_str(), "w");
+    if (!instructores) return false;
+    for (int id : permutacion(n, generador)) {
+        std::fprintf(instructores, "%d,Ins%d Ape,%d,%d,%s\n", id, id, 2000 + id % 25, 400000 + id % 100000,
+                     NOMBRES_ESTILO[id % NUM_ESTILOS_BAILE]);
+    }
+    std::fclose(instructores);
+
+    std::FILE* estudiantes = std::fopen((directorio / "estudiantes.csv").string().c_str(), "w");
+    if (!estudiantes) return false;
+    for (int id : permutacion(n, generador)) {
+        Fecha f = fechaAleatoria(generador);
+        EstiloBaile preferencias[3];
+        int numPreferencias = preferenciasAleatorias(generador, preferencias);
+        std::fprintf(estudiantes, "%d,Nom%d Ape,%02d/%02d/%04d %02d:%02d,", id, id, f.mes, f.dia, f.anio, f.hora,
+                     f.minuto);
+        for (int i = 0; i < numPreferencias; i++) {
+            std::fprintf(estudiantes, "%s%s", i ? "|" : "", NOMBRES_ESTILO[(unsigned)preferencias[i]]);
+        }
+        std::fputc('\n', estudiantes);
+    }
+    std::fclose(estudiantes);
+    return true;
+}
+
+/**
+ * @brief Operaciones del Sistema completo sobre archivos con n estudiantes y n instructores.
+ *
+ * La importación de los CSV se mide sola, sin la compactación que cargarDatos() hace después.
+ * Antes de guardar se registran en la bitácora n / 2 cambios (matrículas y eliminaciones),
+ * suficientes para que se disparen las compactaciones automáticas; su costo amortizado queda
+ * en registrar_cambios. guardar_datos se mide después, con los registros que quedaron en la
+ * bitácora: como cada cambio ya es durable, solo compacta si se alcanzó el umbral, y compactar
+ * mide la escritura del snapshot con esa bitácora pendiente.
+ */
+bool medirSistema(size_t n, const std::filesystem::path& base, int hilos, std::mt19937& generador) {
+    std::filesystem::path directorio = base / ("n" + std::to_string(n));
+    std::error_code ec;
+    std::filesystem::remove_all(directorio, ec);
+    std::filesystem::create_directories(directorio, ec);
+    if (ec || !escribirCSV(directorio, n, generador)) {
+        std::fprintf(stderr, "No se pudieron escribir los datos en %s\n", directorio.string().c_str());
+        return false;
+    }
+    const std::string rutaDatos = directorio.string() + "/";
+    const size_t cambios = n / 2;
+    // Se deja lugar para que las matrículas encuentren IDs libres sin depender de las eliminaciones
+    const int capacidadIds = (int)std::min<size_t>(std::max<size_t>(n + cambios, AsignadorIds::CAPACIDAD_POR_OMISION),
+                                                   AsignadorIds::CAPACIDAD_MAXIMA);
+
+    {
+        Sistema sistema(rutaDatos);
+        sistema.setCapacidadIds(capacidadIds);
+        sistema.setHilosCarga(hilos);
+        informar("importar_csv", n, 2 * n, medir([&] { sistema.importarCSV(); }));
+    }
+    {
+        // La primera carga importa los CSV de nuevo y escribe el snapshot inicial; ya se midió por partes
+        Sistema sistema(rutaDatos);
+        sistema.setCapacidadIds(capacidadIds);
+        sistema.setHilosCarga(hilos);
+        sistema.cargarDatos();
+
+        std::vector<int> consultas(n);
+        for (size_t i = 0; i < n; i++) consultas[i] = (int)(generador() % (2 * n));
+        informar("id_existe_estudiante", n, n, medir([&] {
+            size_t encontrados = 0;
+            for (int id : consultas) encontrados += sistema.idExiste(id, true);
+            sumidero = sumidero + encontrados;
+        }));
+        informar("id_existe_instructor", n, n, medir([&] {
+            size_t encontrados = 0;
+            for (int id : consultas) encontrados += sistema.idExiste(id, false);
+            sumidero = sumidero + encontrados;
+        }));
+
+        // Se repite el cálculo hasta sumar al menos 10^6 instructores para que sea medible
+        const size_t repeticiones = std::max<size_t>(1, 1000000 / n);
+        informar("calcular_pagos", n, repeticiones * n, medir([&] {
+            for (size_t r = 0; r < repeticiones; r++) {
+                MotorPagos motor;
+                sistema.calcularMotorPagos(motor);
+                sumidero = sumidero + (size_t)motor.getSueldoLiquido(0);
+            }
+        }));
+
+        // Mitad matrículas y mitad eliminaciones de estudiantes existentes, intercaladas; incluye
+        // las compactaciones que la propia bitácora dispare al llegar a su umbral
+        std::vector<int> eliminados = permutacion(n, generador);
+        std::vector<Fecha> fechas(cambios);
+        for (Fecha& f : fechas) f = fechaAleatoria(generador);
+        informar("registrar_cambios", n, cambios, medir([&] {
+            std::string error;
+            size_t aplicados = 0;
+            for (size_t i = 0; i < cambios; i++) {
+                if (i % 2 == 0) {
+                    EstiloBaile preferencias[3] = {(EstiloBaile)(i % NUM_ESTILOS_BAILE)};
+                    const Fecha& f = fechas[i];
+                    aplicados += sistema.matricularEstudiante("Cam" + std::to_string(i) + " Ape", f.dia, f.mes,
+                                                              f.anio, f.hora, f.minuto, preferencias, 1, error) >= 0;
+                } else {
+                    aplicados += sistema.eliminarEstudiante(eliminados[i / 2]);
+                }
+            }
+            sumidero = sumidero + aplicados;
+        }));
+
+        informar("guardar_datos", n, 1, medir([&] { sistema.guardarDatos(); }));
+        informar("compactar", n, 2 * n, medir([&] { sistema.compactar(); }));
+    }
+    {
+        Sistema sistema(rutaDatos);
+        sistema.setCapacidadIds(capacidadIds);
+        informar("cargar_datos_snapshot", n, 2 * n, medir([&] { sistema.cargarDatos(); }));
+    }
+
+    std::filesystem::remove_all(directorio, ec);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t maximo = 10000000;
+    std::filesystem::path directorio = std::filesystem::temp_directory_path() / "taller3_benchmark";
+    unsigned semilla = 12345;
+    int hilos = 0;
+
+    for (int i = 1; i < argc; i++) {
+        std::string opcion = argv[i];
+        if (opcion == "--max" && i + 1 < argc) {
+            maximo = std::strtoull(argv[++i], nullptr, 10);
+        } else if (opcion == "--dir" && i + 1 < argc) {
+            directorio = argv[++i];
+        } else if (opcion == "--semilla" && i + 1 < argc) {
+            semilla = (unsigned)std::strtoul(argv[++i], nullptr, 10);
+        } else if (opcion == "--hilos" && i + 1 < argc) {
+            hilos = std::atoi(argv[++i]);
+        } else {
+            std::fprintf(stderr, "Uso: %s [--max <n>] [--dir <directorio temporal>] [--semilla <s>] [--hilos <n>]\n",
+                         argv[0]);
+            return 1;
+        }
+    }
+    // Cada registro necesita su propio ID de estudiante
+    if (maximo < 1000 || maximo > (size_t)AsignadorIds::CAPACIDAD_MAXIMA) {
+        std::fprintf(stderr, "--max debe estar entre 1000 y %d\n", AsignadorIds::CAPACIDAD_MAXIMA);
+        return 1;
+    }
+    if (hilos < 0) {
+        std::fprintf(stderr, "--hilos no puede ser negativo\n");
+        return 1;
+    }
+
+    std::mt19937 generador(semilla);
+    for (size_t n = 1000; n <= maximo; n *= 10) {
+        medirAVL(n, generador);
+        medirABB(n, generador);
+        if (!medirSistema(n, directorio, hilos, generador)) return 1;
+    }
+    std::error_code ec;
+    std::filesystem::remove_all(directorio, ec);
+    return 0;
+}
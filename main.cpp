@@ -1,10 +1,156 @@
+#include <charconv>
+#include <csignal>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <string>
+#include "ProcesadorLotes.h"
+#include "ServidorSocket.h"
 #include "Sistema.h"
 
-int main() {
-    Sistema sistema;
-    sistema.cargarDatos();
+// Servidor en ejecución, para que SIGINT y SIGTERM lo detengan de forma ordenada
+static ServidorSocket* servidorActivo = nullptr;
+
+static void detenerServidor(int) {
+    if (servidorActivo) servidorActivo->detener();
+}
+
+// Convierte un entero en base 10; falla si el texto está vacío, sobra algo o no cabe en un int
+static bool leerEntero(const std::string& texto, int& valor) {
+    const char* fin = texto.data() + texto.size();
+    auto [resto, ec] = std::from_chars(texto.data(), fin, valor);
+    return ec == std::errc() && resto == fin;
+}
+
+// Muestra las opciones de línea de comandos
+static void mostrarUso(const char* programa) {
+    std::cerr << "Uso:\n"
+              << "  " << programa << "                      Menu interactivo\n"
+              << "  " << programa << " --pagos <archivo> [--formato csv|json]\n"
+              << "      Calcula los pagos de los instructores, los escribe en <archivo> y termina\n"
+              << "  " << programa << " --lote [archivo]\n"
+              << "      Ejecuta los comandos de <archivo> (o de la entrada estandar) sin menu:\n"
+              << "        matricular,<Nombre Apellido>,<MM/DD/YYYY HH:MM>,<Estilo>[|<Estilo>...]\n"
+              << "        buscar,<id>   eliminar,<id>   instructor,<id>   eliminar_instructor,<id>\n"
+              << "        pagos   listar   rango,<desde>,<hasta>[,<Estilo>]   nombre,<texto>[,prefijo|apellido]\n"
+              << "  " << programa << " --servidor <socket>\n"
+              << "      Carga los datos una vez y atiende los mismos comandos en un socket de dominio Unix\n"
+              << "      hasta recibir SIGINT o SIGTERM\n"
+              << "Opciones comunes:\n"
+              << "  --datos <directorio>   Directorio de los archivos de datos (por defecto D:/Taller3/)\n"
+              << "  --ids <cantidad>       Tamano del espacio de IDs de estudiante (por defecto 10000, maximo "
+              << AsignadorIds::CAPACIDAD_MAXIMA << ")\n"
+              << "  --hilos <n>            Hilos para analizar estudiantes.csv (0 = uno por nucleo, 1 = secuencial)\n"
+              << "  --importar-csv         Si sistema.snap esta danado, apartarlo junto con cambios.wal y\n"
+              << "                         reconstruir los datos desde los CSV\n";
+}
+
+int main(int argc, char* argv[]) {
+    std::string directorio = "D:/Taller3/";
+    std::string rutaPagos;
+    std::string formato = "csv";
+    bool modoLote = false;
+    std::string rutaLote;
+    std::string rutaSocket;
+    int capacidadIds = AsignadorIds::CAPACIDAD_POR_OMISION;
+    bool conCapacidadIds = false;
+    int hilosCarga = 0;
+    bool reconstruirDesdeCSV = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string opcion = argv[i];
+        if (opcion == "--lote") {
+            modoLote = true;
+            // El archivo es opcional; sin él se lee la entrada estándar
+            if (i + 1 < argc && std::string(argv[i + 1]).rfind("--", 0) != 0) rutaLote = argv[++i];
+        } else if (opcion == "--importar-csv") {
+            reconstruirDesdeCSV = true;
+        } else if ((opcion == "--pagos" || opcion == "--formato" || opcion == "--datos" || opcion == "--ids" ||
+                    opcion == "--servidor" || opcion == "--hilos") &&
+                   i + 1 < argc) {
+            std::string valor = argv[++i];
+            if (opcion == "--pagos") rutaPagos = valor;
+            else if (opcion == "--servidor") rutaSocket = valor;
+            else if (opcion == "--formato") formato = valor;
+            else if (opcion == "--datos") directorio = valor;
+            else if (!leerEntero(valor, opcion == "--ids" ? capacidadIds : hilosCarga)) {
+                std::cerr << "Valor invalido para " << opcion << ": " << valor << "\n";
+                return 1;
+            } else if (opcion == "--ids") {
+                conCapacidadIds = true;
+            }
+        } else {
+            mostrarUso(argv[0]);
+            return 1;
+        }
+    }
+    if (hilosCarga < 0) {
+        std::cerr << "Cantidad de hilos invalida: " << hilosCarga << "\n";
+        return 1;
+    }
+    if (formato != "csv" && formato != "json") {
+        std::cerr << "Formato invalido: " << formato << "\n";
+        mostrarUso(argv[0]);
+        return 1;
+    }
+    if (!directorio.empty() && directorio.back() != '/' && directorio.back() != '\\') {
+        directorio += '/';
+    }
+
+    Sistema sistema(directorio);
+    if (conCapacidadIds && !sistema.setCapacidadIds(capacidadIds)) {
+        std::cerr << "Cantidad de IDs invalida: " << capacidadIds << " (debe estar entre 1 y "
+                  << AsignadorIds::CAPACIDAD_MAXIMA << ")\n";
+        return 1;
+    }
+    sistema.setHilosCarga(hilosCarga);
+    if (!sistema.cargarDatos(reconstruirDesdeCSV)) return 1;
+
+    // Modo no interactivo: solo la planilla de pagos
+    if (!rutaPagos.empty()) {
+        bool ok = sistema.exportarPagos(rutaPagos, formato == "csv" ? FormatoPagos::CSV : FormatoPagos::JSONL);
+        sistema.guardarDatos();
+        return ok ? 0 : 1;
+    }
+
+    // Modo por lotes: comandos sin preguntas, respuestas por la salida estándar
+    if (modoLote) {
+        std::ifstream archivoLote;
+        if (!rutaLote.empty() && rutaLote != "-") {
+            archivoLote.open(rutaLote);
+            if (!archivoLote) {
+                std::cerr << "No se pudo abrir el archivo de comandos " << rutaLote << "\n";
+                return 1;
+            }
+        }
+        ProcesadorLotes lote(sistema, stdout);
+        lote.ejecutar(archivoLote.is_open() ? archivoLote : std::cin);
+        std::cerr << "Lote: " << lote.getNumComandos() << " comandos, " << lote.getNumErrores() << " con error\n";
+        sistema.guardarDatos();
+        return 0;
+    }
+
+    // Modo servidor: los datos quedan cargados y cada cliente se conecta al socket
+    if (!rutaSocket.empty()) {
+        ServidorSocket servidor(sistema, rutaSocket);
+        std::string error;
+        if (!servidor.iniciar(error)) {
+            std::cerr << "No se pudo iniciar el servidor: " << error << "\n";
+            return 1;
+        }
+        servidorActivo = &servidor;
+        std::signal(SIGINT, detenerServidor);
+        std::signal(SIGTERM, detenerServidor);
+        std::cerr << "Escuchando en " << rutaSocket << "\n";
+        servidor.ejecutar();
+        servidorActivo = nullptr;
+        std::cerr << "Servidor: " << servidor.getNumConexiones() << " conexiones, " << servidor.getNumComandos()
+                  << " comandos\n";
+        sistema.guardarDatos();
+        return 0;
+    }
+
     sistema.mostrarMenu();
     sistema.guardarDatos();
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,183 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include "Sistema.h"
+
+/*
+  Pruebas de regresion de la persistencia: cada prueba trabaja sobre un directorio temporal
+  propio, reinicia el sistema y comprueba que los datos confirmados sigan ahi.
+  Devuelve 0 si todas pasan; cada falla se informa por la salida de errores.
+
+  Uso: pruebas [directorio temporal]
+*/
+
+namespace {
+
+int fallas = 0;
+
+void comprobar(bool condicion, const char* prueba, const char* descripcion) {
+    if (!condicion) {
+        std::fprintf(stderr, "FALLA %s: %s\n", prueba, descripcion);
+        fallas++;
+    }
+}
+
+// Crea un directorio vacío con un instructor y un estudiante en los CSV
+std::string prepararDirectorio(const std::filesystem::path& base, const char* nombre) {
+    std::filesystem::path directorio = base / nombre;
+    std::error_code ec;
+    std::filesystem::remove_all(directorio, ec);
+    std::filesystem::create_directories(directorio, ec);
+    std::ofstream(directorio / "instructores.csv") << "1010,Rocky Balboa,2006,800000,Salsa\n";
+    std::ofstream(directorio / "estudiantes.csv") << "0505,Benjamin Vistanda,05/02/2022 17:36,Reggaeton|Salsa\n";
+    return directorio.string() + "/";
+}
+
+/**
+ * @brief Un nombre demasiado largo se rechaza y no daña la bitácora de las matrículas siguientes.
+ */
+void pruebaNombreLargo(const std::filesystem::path& base) {
+    const char* prueba = "nombre_largo";
+    const std::string ruta = prepararDirectorio(base, prueba);
+    const EstiloBaile preferencias[1] = {EstiloBaile::Salsa};
+    const std::string enElLimite = std::string(Estudiante::LARGO_MAXIMO_NOMBRE - 5, 'A') + " Zulu";
+    int idLimite, idValido;
+    {
+        Sistema sistema(ruta);
+        sistema.cargarDatos();
+        std::string error;
+        int id = sistema.matricularEstudiante(std::string(70000, 'A') + " Zulu", 1, 2, 2024, 10, 0,
+                                              preferencias, 1, error);
+        comprobar(id < 0, prueba, "se acepto un nombre de 70000 bytes");
+        idLimite = sistema.matricularEstudiante(enElLimite, 1, 2, 2024, 10, 5, preferencias, 1, error);
+        comprobar(idLimite >= 0, prueba, "se rechazo un nombre en el largo maximo");
+        idValido = sistema.matricularEstudiante("Zed Zulu", 1, 2, 2024, 10, 10, preferencias, 1, error);
+        comprobar(idValido >= 0, prueba, "se rechazo una matricula valida");
+    }
+    Sistema reiniciado(ruta);
+    reiniciado.cargarDatos();
+    const Estudiante* limite = reiniciado.buscarEstudiantePorId(idLimite);
+    comprobar(limite && limite->getNombre() == enElLimite, prueba,
+              "la matricula con nombre en el largo maximo no sobrevivio al reinicio");
+    comprobar(reiniciado.buscarEstudiantePorId(idValido) != nullptr, prueba,
+              "la matricula valida no sobrevivio al reinicio");
+    comprobar(reiniciado.buscarEstudiantePorId(505) != nullptr, prueba, "se perdio un estudiante de los CSV");
+}
+
+/**
+ * @brief Si la bitácora no acepta el registro, el cambio no se confirma ni se aplica en memoria.
+ *
+ * La bitácora se enlaza a /dev/full, donde toda escritura falla por falta de espacio; solo
+ * existe en Linux, así que en otros sistemas la prueba se omite.
+ */
+void pruebaBitacoraLlena(const std::filesystem::path& base) {
+#ifdef __linux__
+    const char* prueba = "bitacora_llena";
+    const std::string ruta = prepararDirectorio(base, prueba);
+    {
+        Sistema sistema(ruta);
+        sistema.cargarDatos();
+    }
+    std::error_code ec;
+    std::filesystem::remove(ruta + "cambios.wal", ec);
+    std::filesystem::create_symlink("/dev/full", ruta + "cambios.wal", ec);
+    if (ec) return;
+    {
+        Sistema sistema(ruta);
+        sistema.cargarDatos();
+        const EstiloBaile preferencias[1] = {EstiloBaile::Tango};
+        std::string error;
+        int id = sistema.matricularEstudiante("Zed Zulu", 1, 2, 2024, 10, 0, preferencias, 1, error);
+        comprobar(id < 0 && error == "no se pudo registrar el cambio", prueba,
+                  "se confirmo una matricula que no quedo en la bitacora");
+        comprobar(sistema.buscarPorNombre("Zed Zulu", BusquedaNombre::Exacta).empty(), prueba,
+                  "la matricula no registrada quedo en memoria");
+        error.clear();
+        comprobar(!sistema.eliminarEstudiante(505, &error) && error == "no se pudo registrar el cambio", prueba,
+                  "se confirmo la eliminacion de un estudiante que no quedo en la bitacora");
+        comprobar(sistema.buscarEstudiantePorId(505) != nullptr, prueba,
+                  "el estudiante cuya eliminacion no se registro desaparecio");
+        error.clear();
+        comprobar(!sistema.eliminarInstructor(1010, &error) && error == "no se pudo registrar el cambio", prueba,
+                  "se confirmo la eliminacion de un instructor que no quedo en la bitacora");
+        comprobar(sistema.buscarInstructorPorId(1010) != nullptr, prueba,
+                  "el instructor cuya eliminacion no se registro desaparecio");
+    }
+    std::filesystem::remove(ruta + "cambios.wal", ec);
+    Sistema reiniciado(ruta);
+    reiniciado.cargarDatos();
+    comprobar(reiniciado.buscarEstudiantePorId(505) != nullptr && reiniciado.buscarInstructorPorId(1010) != nullptr,
+              prueba, "los datos cambiaron tras el reinicio");
+#else
+    (void)base;
+#endif
+}
+
+/**
+ * @brief Un snapshot dañado no se sobrescribe con los CSV ni se le descarta la bitácora.
+ *
+ * Sin pedirlo, la carga falla y deja ambos archivos intactos; al pedir la reconstrucción
+ * se apartan con sufijo ".danado" en lugar de perderse.
+ */
+void pruebaSnapshotDanado(const std::filesystem::path& base) {
+    const char* prueba = "snapshot_danado";
+    const std::string ruta = prepararDirectorio(base, prueba);
+    {
+        Sistema sistema(ruta);
+        sistema.cargarDatos();
+        const EstiloBaile preferencias[1] = {EstiloBaile::Salsa};
+        std::string error;
+        sistema.matricularEstudiante("Zed Zulu", 1, 2, 2024, 10, 0, preferencias, 1, error);
+    }
+    std::string snapshot, bitacora;
+    {
+        std::ifstream entrada(ruta + "sistema.snap", std::ios::binary);
+        snapshot.assign(std::istreambuf_iterator<char>(entrada), std::istreambuf_iterator<char>());
+    }
+    comprobar(snapshot.size() > 2, prueba, "no se escribio el snapshot");
+    if (snapshot.size() <= 2) return;
+    snapshot[snapshot.size() - 1] ^= 0x5a;
+    snapshot[snapshot.size() - 2] ^= 0x5a;
+    std::ofstream(ruta + "sistema.snap", std::ios::binary) << snapshot;
+    const uintmax_t largoBitacora = std::filesystem::file_size(ruta + "cambios.wal");
+    comprobar(largoBitacora > 0, prueba, "la matricula no quedo en la bitacora");
+
+    {
+        Sistema sistema(ruta);
+        comprobar(!sistema.cargarDatos(), prueba, "se cargo un snapshot danado");
+    }
+    std::string despues;
+    {
+        std::ifstream entrada(ruta + "sistema.snap", std::ios::binary);
+        despues.assign(std::istreambuf_iterator<char>(entrada), std::istreambuf_iterator<char>());
+    }
+    comprobar(despues == snapshot, prueba, "el snapshot danado se modifico sin pedirlo");
+    comprobar(std::filesystem::file_size(ruta + "cambios.wal") == largoBitacora, prueba,
+              "la bitacora se modifico sin pedirlo");
+
+    Sistema reconstruido(ruta);
+    comprobar(reconstruido.cargarDatos(true), prueba, "no se pudo reconstruir desde los CSV");
+    comprobar(std::filesystem::exists(ruta + "sistema.snap.danado") &&
+              std::filesystem::exists(ruta + "cambios.wal.danado"), prueba,
+              "no se conservaron el snapshot y la bitacora anteriores");
+    comprobar(reconstruido.buscarEstudiantePorId(505) != nullptr &&
+              reconstruido.buscarPorNombre("Zed Zulu", BusquedaNombre::Exacta).empty(), prueba,
+              "la reconstruccion no partio solo de los CSV");
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::filesystem::path base = argc > 1 ? std::filesystem::path(argv[1])
+                                          : std::filesystem::temp_directory_path() / "taller3_pruebas";
+    pruebaNombreLargo(base);
+    pruebaBitacoraLlena(base);
+    pruebaSnapshotDanado(base);
+
+    std::error_code ec;
+    std::filesystem::remove_all(base, ec);
+    if (fallas == 0) std::printf("Todas las pruebas pasaron\n");
+    return fallas == 0 ? 0 : 1;
+}